@@ -1395,6 +1395,82 @@ namespace ConfigurationObjects
 
 
 
+    //-----------------------------------------------------------
+    JSON_SERIALIZED_CLASS(UdpMediaTransport)
+    /** 
+     * @brief Datagram transport for media between the Engine and a Rallypoint, or between Rallypoints
+     * 
+     * Helper C++ class to serialize and de-serialize UdpMediaTransport JSON
+     * 
+     * By default, all traffic to a Rallypoint is carried on the TLS connection, so a single lost TCP segment stalls every
+     * group on that link until it is retransmitted.  When enabled, media packets are instead sent as UDP datagrams, each
+     * protected with AES-GCM using keys exported from the TLS session (RFC 5705) together with a replay window.  The
+     * TLS connection is kept for control traffic and registration.  If no datagrams are acknowledged within
+     * @ref fallbackTimeoutMs - because UDP is blocked, for example - media reverts to the TLS connection.
+     * 
+     * NOTE: Only the configuration contract is defined here.  The UDP transport needs Engine and Rallypoint builds that
+     * implement it; the binaries in bin/ ignore this object and carry all media on the TLS connection.
+     * 
+     * Example: @include[doc] examples/UdpMediaTransport.json 
+     * 
+     * @see Rallypoint, RallypointServer
+     */    
+    class UdpMediaTransport : public ConfigurationObjectBase
+    {
+        IMPLEMENT_JSON_SERIALIZATION()
+        IMPLEMENT_JSON_DOCUMENTATION(UdpMediaTransport)
+        
+    public:
+        /** @brief [Optional, Default: false] Enables the UDP media transport. */
+        bool            enabled;
+
+        /** @brief [Optional, Default: 0] UDP port of the Rallypoint (or, for the Rallypoint server, the port to listen on).  0 uses the same port number as the TLS connection. */
+        int             port;
+
+        /** @brief [Optional, Default: 5000] Interval at which keepalives are sent to keep NAT bindings open and detect loss of the path. */
+        int             keepaliveIntervalMs;
+
+        /** @brief [Optional, Default: 3000] Time without acknowledgement after which media falls back to the TLS connection. */
+        int             fallbackTimeoutMs;
+
+        /** @brief [Optional, Default: 1024] Size, in packets, of the anti-replay window. */
+        int             replayWindowPackets;
+
+        UdpMediaTransport()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            enabled = false;
+            port = 0;
+            keepaliveIntervalMs = 5000;
+            fallbackTimeoutMs = 3000;
+            replayWindowPackets = 1024;
+        }
+    };
+    
+    static void to_json(nlohmann::json& j, const UdpMediaTransport& p)
+    {
+        j = nlohmann::json{
+            TOJSON_IMPL(enabled),
+            TOJSON_IMPL(port),
+            TOJSON_IMPL(keepaliveIntervalMs),
+            TOJSON_IMPL(fallbackTimeoutMs),
+            TOJSON_IMPL(replayWindowPackets)
+        };
+    }
+    static void from_json(const nlohmann::json& j, UdpMediaTransport& p)
+    {
+        p.clear();
+        getOptional<bool>("enabled", p.enabled, j, false);
+        getOptional<int>("port", p.port, j, 0);
+        getOptional<int>("keepaliveIntervalMs", p.keepaliveIntervalMs, j, 5000);
+        getOptional<int>("fallbackTimeoutMs", p.fallbackTimeoutMs, j, 3000);
+        getOptional<int>("replayWindowPackets", p.replayWindowPackets, j, 1024);
+    }
+
     //-----------------------------------------------------------
     JSON_SERIALIZED_CLASS(Rallypoint)
     /** 
@@ -1410,6 +1486,27 @@ namespace ConfigurationObjects
         IMPLEMENT_JSON_DOCUMENTATION(Rallypoint)
         
     public:
+        /**
+         * @brief How control messages exchanged with a Rallypoint are authenticated
+         *
+         * A session HMAC only proves which link a message arrived on.  It is hop-by-hop authentication, not end-to-end
+         * authentication of the message's origin - any Rallypoint holding the link key could have written the message.
+         * maSessionHmac is therefore only used for messages that end at the other side of the link.  Messages that a
+         * Rallypoint relays to other Rallypoints - traffic forwarded with RallypointServer::allowPeerForwarding, registrations
+         * passed on with RallypointServer::reciprocateRegistrations, and RallypointMeshRouting advertisements - are always
+         * signed by their originator so that every Rallypoint along the way can verify where they came from.
+         *
+         * NOTE: Only the configuration contract is defined here.  maSessionHmac needs Engine and Rallypoint builds that
+         * implement it; the binaries in bin/ ignore this setting and always sign.
+         */
+        typedef enum
+        {
+            /** @brief Each message is signed with the sender's certificate key */
+            maSignature = 0,
+
+            /** @brief Messages that end at the other side of the link carry an HMAC-SHA256 tag keyed by a secret exported from the link's TLS session (RFC 5705); relayed messages are still signed.  Used only when both ends of the link are set for it - otherwise maSignature is used. */
+            maSessionHmac = 1
+        } MessageAuthentication_t;
 
         /**
          * @brief This is the host address for the Engine to connect to the RallyPoint service.  
@@ -1478,6 +1575,12 @@ namespace ConfigurationObjects
         int                         transactionTimeoutMs;
         bool                        disableMessageSigning;
 
+        /** @brief [Optional, Default: maSignature] How control messages on the link are authenticated when signing is not disabled.  Requires an Engine and Rallypoint that support session HMACs.  See @ref MessageAuthentication_t. */
+        MessageAuthentication_t     messageAuthentication;
+
+        /** @brief [Optional] Carry media over UDP rather than the TLS connection.  Requires an Engine that supports the UDP media transport.  See @ref UdpMediaTransport. */
+        UdpMediaTransport           udpMedia;
+
 
         Rallypoint()
         {
@@ -1493,6 +1596,8 @@ namespace ConfigurationObjects
             verifyPeer = false;
             transactionTimeoutMs = 5000;
             disableMessageSigning = false;
+            messageAuthentication = maSignature;
+            udpMedia.clear();
         }
     };
     
@@ -1506,7 +1611,9 @@ namespace ConfigurationObjects
             TOJSON_IMPL(allowSelfSignedCertificate),
             TOJSON_IMPL(caCertificates),
             TOJSON_IMPL(transactionTimeoutMs),
-            TOJSON_IMPL(disableMessageSigning)
+            TOJSON_IMPL(disableMessageSigning),
+            TOJSON_IMPL(messageAuthentication),
+            TOJSON_IMPL(udpMedia)
         };
     }
     static void from_json(const nlohmann::json& j, Rallypoint& p)
@@ -1537,6 +1644,207 @@ namespace ConfigurationObjects
         }
 
         getOptional<bool>("disableMessageSigning", p.disableMessageSigning, j, false);
+        getOptional<Rallypoint::MessageAuthentication_t>("messageAuthentication", p.messageAuthentication, j, Rallypoint::MessageAuthentication_t::maSignature);
+        getOptional<UdpMediaTransport>("udpMedia", p.udpMedia, j);
+    }
+
+    //-----------------------------------------------------------
+    JSON_SERIALIZED_CLASS(Vad)
+    /**
+     * @brief Voice Activity Detection (VAD) settings for the transmit pipeline of a group
+     *
+     * Helper C++ class to serialize and de-serialize Vad JSON
+     *
+     * When enabled, the Engine classifies each captured frame as speech or silence before it is encoded.  Silent frames
+     * are then either suppressed entirely or thinned out so that a long transmission does not keep producing packets
+     * while the talker pauses.  This applies to all codecs - including those (such as G.711 and GSM) that have no native
+     * discontinuous transmission (DTX) capability.
+     *
+     * NOTE: Only the configuration is defined here.  VAD needs an Engine build that implements it - the Engine binaries
+     * in bin/ ignore this object and transmit every frame.
+     *
+     * Example: @include[doc] examples/Vad.json
+     *
+     * @see TxAudio
+     */
+    class Vad : public ConfigurationObjectBase
+    {
+        IMPLEMENT_JSON_SERIALIZATION()
+        IMPLEMENT_JSON_DOCUMENTATION(Vad)
+
+    public:
+        /** @brief What to do with frames classified as silence. */
+        typedef enum
+        {
+            /** @brief Do not transmit silent frames at all */
+            vmSuppress      = 0,
+
+            /** @brief Transmit one silent frame every @ref thinIntervalMs */
+            vmThin          = 1
+        } Mode_t;
+
+        /** @brief [Optional, Default: false] Enables voice activity detection on transmit. */
+        bool            enabled;
+
+        /** @brief [Optional, Default: @ref vmSuppress] How silent frames are handled.  See @ref Mode_t. */
+        Mode_t          mode;
+
+        /** @brief [Optional, Default: -50] Frame energy, in dBFS, below which a frame is considered silent. */
+        int             thresholdDb;
+
+        /** @brief [Optional, Default: 300] Number of milliseconds to keep transmitting after speech ends so that word endings are not clipped. */
+        int             hangoverMs;
+
+        /** @brief [Optional, Default: 500] When @ref mode is @ref vmThin, the interval at which a silent frame is still transmitted. */
+        int             thinIntervalMs;
+
+        /** @brief [Optional, Default: true] Use the codec's own DTX where the codec supports it (Opus, AMR) rather than the Engine's detector. */
+        bool            useCodecDtx;
+
+        /**
+         * @brief [Optional, Default: true] Send comfort noise (CN) indications during silence.
+         *
+         * A comfort noise packet is sent when silence begins and then every @ref comfortNoiseIntervalMs so that receivers can
+         * play low-level noise rather than dead air and do not mistake the silence for the end of the transmission.
+         */
+        bool            comfortNoise;
+
+        /** @brief [Optional, Default: 1000] Interval at which comfort noise updates are sent during silence. */
+        int             comfortNoiseIntervalMs;
+
+        Vad()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            enabled = false;
+            mode = vmSuppress;
+            thresholdDb = -50;
+            hangoverMs = 300;
+            thinIntervalMs = 500;
+            useCodecDtx = true;
+            comfortNoise = true;
+            comfortNoiseIntervalMs = 1000;
+        }
+    };
+
+    static void to_json(nlohmann::json& j, const Vad& p)
+    {
+        j = nlohmann::json{
+            TOJSON_IMPL(enabled),
+            TOJSON_IMPL(mode),
+            TOJSON_IMPL(thresholdDb),
+            TOJSON_IMPL(hangoverMs),
+            TOJSON_IMPL(thinIntervalMs),
+            TOJSON_IMPL(useCodecDtx),
+            TOJSON_IMPL(comfortNoise),
+            TOJSON_IMPL(comfortNoiseIntervalMs)
+        };
+    }
+    static void from_json(const nlohmann::json& j, Vad& p)
+    {
+        p.clear();
+        getOptional<bool>("enabled", p.enabled, j, false);
+        getOptional<Vad::Mode_t>("mode", p.mode, j, Vad::Mode_t::vmSuppress);
+        getOptional<int>("thresholdDb", p.thresholdDb, j, -50);
+        getOptional<int>("hangoverMs", p.hangoverMs, j, 300);
+        getOptional<int>("thinIntervalMs", p.thinIntervalMs, j, 500);
+        getOptional<bool>("useCodecDtx", p.useCodecDtx, j, true);
+        getOptional<bool>("comfortNoise", p.comfortNoise, j, true);
+        getOptional<int>("comfortNoiseIntervalMs", p.comfortNoiseIntervalMs, j, 1000);
+    }
+
+    //-----------------------------------------------------------
+    JSON_SERIALIZED_CLASS(AdaptivePacketization)
+    /**
+     * @brief Adaptive packetization settings for the transmit pipeline of a group
+     *
+     * Helper C++ class to serialize and de-serialize AdaptivePacketization JSON
+     *
+     * By default every packet carries a single frame of @ref TxAudio::framingMs.  When adaptive packetization is enabled
+     * the Engine bundles between @ref minFramesPerPacket and @ref maxFramesPerPacket frames into each RTP packet, choosing
+     * the count from the measured Rallypoint round-trip time (as reported through PFN_ENGAGE_RP_ROUNDTRIP_REPORT) and the
+     * packet loss observed on the group.  Bundling reduces header overhead and packets-per-second on degraded links at the
+     * cost of added latency; on a healthy link the Engine stays at @ref minFramesPerPacket.
+     *
+     * NOTE: Round-trip measurements are only taken every @ref EnginePolicyNetworking::rallypointRtTestIntervalMs so that
+     * interval should be shortened for the Engine to react quickly to changing link conditions.
+     *
+     * NOTE: This object defines configuration only.  An Engine that implements adaptive packetization is needed for it to
+     * take effect; the Engine binaries in bin/ ignore it and always send one frame per packet.
+     *
+     * Example: @include[doc] examples/AdaptivePacketization.json
+     *
+     * @see TxAudio
+     */
+    class AdaptivePacketization : public ConfigurationObjectBase
+    {
+        IMPLEMENT_JSON_SERIALIZATION()
+        IMPLEMENT_JSON_DOCUMENTATION(AdaptivePacketization)
+
+    public:
+        /** @brief [Optional, Default: false] Enables adaptive packetization. */
+        bool            enabled;
+
+        /** @brief [Optional, Default: 1] The fewest frames to place in a packet. */
+        int             minFramesPerPacket;
+
+        /** @brief [Optional, Default: 4] The most frames to place in a packet. */
+        int             maxFramesPerPacket;
+
+        /** @brief [Optional, Default: 250] Round-trip time, in milliseconds, above which frames-per-packet is increased. */
+        int             rttThresholdMs;
+
+        /** @brief [Optional, Default: 3] Packet loss percentage above which frames-per-packet is increased. */
+        int             lossThresholdPercentage;
+
+        /** @brief [Optional, Default: 5000] Interval at which link conditions are evaluated. */
+        int             evaluationIntervalMs;
+
+        /** @brief [Optional, Default: 15000] Minimum time between changes to frames-per-packet so that the Engine does not flap between settings. */
+        int             minChangeIntervalMs;
+
+        AdaptivePacketization()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            enabled = false;
+            minFramesPerPacket = 1;
+            maxFramesPerPacket = 4;
+            rttThresholdMs = 250;
+            lossThresholdPercentage = 3;
+            evaluationIntervalMs = 5000;
+            minChangeIntervalMs = 15000;
+        }
+    };
+
+    static void to_json(nlohmann::json& j, const AdaptivePacketization& p)
+    {
+        j = nlohmann::json{
+            TOJSON_IMPL(enabled),
+            TOJSON_IMPL(minFramesPerPacket),
+            TOJSON_IMPL(maxFramesPerPacket),
+            TOJSON_IMPL(rttThresholdMs),
+            TOJSON_IMPL(lossThresholdPercentage),
+            TOJSON_IMPL(evaluationIntervalMs),
+            TOJSON_IMPL(minChangeIntervalMs)
+        };
+    }
+    static void from_json(const nlohmann::json& j, AdaptivePacketization& p)
+    {
+        p.clear();
+        getOptional<bool>("enabled", p.enabled, j, false);
+        getOptional<int>("minFramesPerPacket", p.minFramesPerPacket, j, 1);
+        getOptional<int>("maxFramesPerPacket", p.maxFramesPerPacket, j, 4);
+        getOptional<int>("rttThresholdMs", p.rttThresholdMs, j, 250);
+        getOptional<int>("lossThresholdPercentage", p.lossThresholdPercentage, j, 3);
+        getOptional<int>("evaluationIntervalMs", p.evaluationIntervalMs, j, 5000);
+        getOptional<int>("minChangeIntervalMs", p.minChangeIntervalMs, j, 15000);
     }
 
     //-----------------------------------------------------------
@@ -1684,6 +1992,12 @@ namespace ConfigurationObjects
         /** @brief [Optional, Default: 5] TODO: SHAUN help. */
         int             trailingHeaderBurst;
 
+        /** @brief [Optional] Voice activity detection and silence suppression settings.  Requires an Engine that supports VAD.  See @ref Vad. */
+        Vad             vad;
+
+        /** @brief [Optional] Settings for bundling multiple frames per packet as link conditions degrade.  Requires an Engine that supports adaptive packetization.  See @ref AdaptivePacketization. */
+        AdaptivePacketization   packetization;
+
 
         TxAudio()
         {
@@ -1703,6 +2017,8 @@ namespace ConfigurationObjects
             userTxFlags = 0;
             initialHeaderBurst = 5;
             trailingHeaderBurst = 5;
+            vad.clear();
+            packetization.clear();
         }
     };
     
@@ -1719,7 +2035,9 @@ namespace ConfigurationObjects
             TOJSON_IMPL(userTxPriority),
             TOJSON_IMPL(userTxFlags),
             TOJSON_IMPL(initialHeaderBurst),
-            TOJSON_IMPL(trailingHeaderBurst)
+            TOJSON_IMPL(trailingHeaderBurst),
+            TOJSON_IMPL(vad),
+            TOJSON_IMPL(packetization)
         };
     }
     static void from_json(const nlohmann::json& j, TxAudio& p)
@@ -1736,6 +2054,8 @@ namespace ConfigurationObjects
         getOptional("extensionSendInterval", p.extensionSendInterval, j, 10);
         getOptional("initialHeaderBurst", p.initialHeaderBurst, j, 5);
         getOptional("trailingHeaderBurst", p.trailingHeaderBurst, j, 5);
+        getOptional<Vad>("vad", p.vad, j);
+        getOptional<AdaptivePacketization>("packetization", p.packetization, j);
     }
 
 
@@ -2282,6 +2602,95 @@ namespace ConfigurationObjects
         getOptional("recordAudio", p.recordAudio, j, true);
     }
 
+    //-----------------------------------------------------------
+    JSON_SERIALIZED_CLASS(RallypointSelection)
+    /**
+     * @brief Describes how the Engine chooses among the Rallypoints configured for a group
+     * 
+     * Helper C++ class to serialize and de-serialize RallypointSelection JSON 
+     * 
+     * With @ref rspOrdered the Engine connects to the entries of @ref Group::rallypoints in the order given and only moves
+     * to the next entry when a connection attempt fails.  With @ref rspLowestRtt the Engine connects to the first
+     * @ref raceCount entries in parallel and keeps the one with the lowest round-trip time, so failover no longer waits
+     * for @ref EnginePolicyNetworking::rpLeafConnectTimeoutSecs per attempt.  Round-trip times continue to be measured every
+     * @ref EnginePolicyNetworking::rallypointRtTestIntervalMs and the group migrates when another Rallypoint is clearly better.
+     * 
+     * Migration is make-before-break: the group is registered on the new Rallypoint before the old connection is released,
+     * and a migration is deferred while the group is transmitting.
+     * 
+     * NOTE: Only the configuration contract is defined here.  Racing and migration need an Engine build that implements
+     * them; the Engine binaries in bin/ ignore this object and always behave as @ref rspOrdered.
+     * 
+     * Example: @include[doc] examples/RallypointSelection.json 
+     *    
+     * @see Group
+     */   
+    class RallypointSelection : public ConfigurationObjectBase
+    {
+        IMPLEMENT_JSON_SERIALIZATION()
+        IMPLEMENT_JSON_DOCUMENTATION(RallypointSelection)
+        
+    public:
+        /** @brief Selection policies. */
+        typedef enum
+        {
+            /** @brief Use the Rallypoints in the order listed */
+            rspOrdered      = 0,
+
+            /** @brief Race connections and use the Rallypoint with the lowest round-trip time */
+            rspLowestRtt    = 1
+        } Policy_t;
+
+        /** @brief [Optional, Default: @ref rspOrdered] The selection policy.  See @ref Policy_t. */
+        Policy_t        policy;
+
+        /** @brief [Optional, Default: 2] The number of Rallypoints, from the top of the list, to connect to in parallel. */
+        int             raceCount;
+
+        /** @brief [Optional, Default: 30] Percentage by which another Rallypoint's round-trip time must beat the current one before the group migrates. */
+        int             migrationRttImprovementPercentage;
+
+        /** @brief [Optional, Default: 50] Minimum absolute round-trip improvement, in milliseconds, before the group migrates. */
+        int             migrationMinRttImprovementMs;
+
+        /** @brief [Optional, Default: 120] Minimum number of seconds between migrations. */
+        int             migrationHoldDownSecs;
+
+        RallypointSelection()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            policy = rspOrdered;
+            raceCount = 2;
+            migrationRttImprovementPercentage = 30;
+            migrationMinRttImprovementMs = 50;
+            migrationHoldDownSecs = 120;
+        }
+    };
+    
+    static void to_json(nlohmann::json& j, const RallypointSelection& p)
+    {
+        j = nlohmann::json{
+            TOJSON_IMPL(policy),
+            TOJSON_IMPL(raceCount),
+            TOJSON_IMPL(migrationRttImprovementPercentage),
+            TOJSON_IMPL(migrationMinRttImprovementMs),
+            TOJSON_IMPL(migrationHoldDownSecs)
+        };
+    }
+    static void from_json(const nlohmann::json& j, RallypointSelection& p)
+    {
+        p.clear();
+        getOptional<RallypointSelection::Policy_t>("policy", p.policy, j, RallypointSelection::Policy_t::rspOrdered);
+        getOptional<int>("raceCount", p.raceCount, j, 2);
+        getOptional<int>("migrationRttImprovementPercentage", p.migrationRttImprovementPercentage, j, 30);
+        getOptional<int>("migrationMinRttImprovementMs", p.migrationMinRttImprovementMs, j, 50);
+        getOptional<int>("migrationHoldDownSecs", p.migrationHoldDownSecs, j, 120);
+    }
+
     //-----------------------------------------------------------
     ENGAGE_IGNORE_COMPILER_UNUSED_WARNING static const char *GROUP_SOURCE_ENGAGE_INTERNAL = "com.rallytac.engage.internal";
     ENGAGE_IGNORE_COMPILER_UNUSED_WARNING static const char *GROUP_SOURCE_ENGAGE_MAGELLAN_CISTECH = "com.rallytac.engage.magellan.cistech" ;
@@ -2363,6 +2772,9 @@ namespace ConfigurationObjects
         /** @brief List of @ref Rallypoint (s) the Group should use to connect to a RallyPoint router. */
         std::vector<Rallypoint>                 rallypoints;
 
+        /** @brief [Optional] How the Engine chooses among the entries in @ref rallypoints (see @ref RallypointSelection).  Policies other than rspOrdered require an Engine that implements them. */
+        RallypointSelection                     rallypointSelection;
+
         /** @brief Sets audio properties like which audio device to use, audio gain etc (see @ref Audio). */
         Audio                                   audio;
 
@@ -2413,6 +2825,7 @@ namespace ConfigurationObjects
             alias.clear();
             
             rallypoints.clear();
+            rallypointSelection.clear();
 
             debugAudio = false;
             audio.clear();
@@ -2441,6 +2854,7 @@ namespace ConfigurationObjects
             TOJSON_IMPL(cryptoPassword),
             TOJSON_IMPL(alias),
             TOJSON_IMPL(rallypoints),
+            TOJSON_IMPL(rallypointSelection),
             TOJSON_IMPL(alias),
             TOJSON_IMPL(audio),
             TOJSON_IMPL(timeline),
@@ -2464,6 +2878,7 @@ namespace ConfigurationObjects
         getOptional<TxAudio>("txAudio", p.txAudio, j);
         getOptional<Presence>("presence", p.presence, j);
         getOptional<std::vector<Rallypoint>>("rallypoints", p.rallypoints, j);
+        getOptional<RallypointSelection>("rallypointSelection", p.rallypointSelection, j);
         getOptional<Audio>("audio", p.audio, j);
         getOptional<GroupTimeline>("timeline", p.timeline, j);
         getOptional<bool>("blockAdvertising", p.blockAdvertising, j, false);
@@ -2666,77 +3081,553 @@ namespace ConfigurationObjects
 
 
     //-----------------------------------------------------------
-    JSON_SERIALIZED_CLASS(EnginePolicyNetworking)
+    JSON_SERIALIZED_CLASS(NetworkIoBackend)
     /**
-    * @brief TODO: Shaun, can you document this class please 
+    * @brief Selects the mechanism used for socket I/O by the Engine and by the Rallypoint server
     * 
-    * Helper C++ class to serialize and de-serialize EnginePolicyNetworking JSON 
+    * Helper C++ class to serialize and de-serialize NetworkIoBackend JSON 
     * 
-    * Example: @include[doc] examples/EnginePolicyNetworking.json 
+    * The default backend is the readiness-based reactor used on all platforms.  On Linux, @ref ibtIoUring submits socket
+    * operations through an io_uring instance instead, with receive buffers registered with the kernel up-front and
+    * multishot receives so that a single submission keeps delivering datagrams without being re-armed.
+    * 
+    * If io_uring is not available - on an older kernel, when it is blocked by a seccomp policy, or on other platforms - the
+    * default backend is to be used and a warning logged.  Likewise, multishot receive is only to be used on kernels that
+    * support it.
+    * 
+    * NOTE: Only the configuration contract is defined here.  The io_uring backend needs Engine and Rallypoint builds that
+    * implement it; the binaries in bin/ ignore this object and always use the default reactor.
+    * 
+    * Example: @include[doc] examples/NetworkIoBackend.json 
     *    
-    * @see TODO: Add references 
+    * @see EnginePolicyNetworking, RallypointServer 
     */       
-    class EnginePolicyNetworking : public ConfigurationObjectBase
+    class NetworkIoBackend : public ConfigurationObjectBase
     {
         IMPLEMENT_JSON_SERIALIZATION()
-        IMPLEMENT_JSON_DOCUMENTATION(EnginePolicyNetworking)
+        IMPLEMENT_JSON_DOCUMENTATION(NetworkIoBackend)
         
     public:
+        /** @brief I/O backend types. */
+        typedef enum
+        {
+            /** @brief The platform's default reactor */
+            ibtDefault      = 0,
 
-        /** @brief This is the default netork interface card the Engage Engine should bind to. TODO: Shaun */ 
-        std::string         defaultNic;
+            /** @brief Linux io_uring */
+            ibtIoUring      = 1
+        } Type_t;
 
-        /** @brief [Optional, Default: 100] TODO: Shaun. */ 
-        int                 maxOutputQueuePackets;
+        /** @brief [Optional, Default: @ref ibtDefault] The backend to use.  See @ref Type_t. */
+        Type_t              type;
 
-        /** @brief [Optional, Default: 100] TODO: Shaun. */ 
-        int                 rtpJitterMinMs;
+        /** @brief [Optional, Default: 256] Number of submission queue entries for each io_uring instance. */
+        int                 queueDepth;
 
-        int                 rtpJitterMaxFactor;
+        /** @brief [Optional, Default: 1024] Number of receive buffers registered with the kernel. */
+        int                 registeredBufferCount;
 
-        /** @brief [Optional, Default: 1000] TODO: Shaun. */ 
-        int                 rtpJitterMaxMs;
+        /** @brief [Optional, Default: 2048] Size, in bytes, of each registered receive buffer. */
+        int                 registeredBufferSize;
 
-        /** @brief [Optional, Default: 5] TODO: Shaun. */ 
-        int                 rtpLatePacketSequenceRange;
+        /** @brief [Optional, Default: true] Use multishot receive operations where the kernel supports them. */
+        bool                multishotReceive;
 
-        int                 rtpJitterOverflowTrimPercentage;
-        int                 rtpJitterUnderrunReductionThresholdMs;
+        /** @brief [Optional, Default: false] Use a kernel thread to poll the submission queue.  This trades a busy CPU core for fewer system calls. */
+        bool                sqPoll;
 
-        /** @brief [Optional, Default: 2000] TODO: Shaun. */ 
-        int                 rtpLatePacketTimestampRangeMs;
+        /** @brief [Optional, Default: 1000] Idle time after which the submission queue polling thread sleeps. */
+        int                 sqPollIdleMs;
 
-        /** @brief [Optional, Default: 500] TODO: Shaun. */ 
-        int                 rtpInboundProcessorInactivityMs;
+        NetworkIoBackend()
+        {
+            clear();
+        }
 
-        /** @brief [Optional, Default: 8] TODO: Shaun. */ 
-        int                 multicastRejoinSecs;
+        void clear()
+        {
+            type = ibtDefault;
+            queueDepth = 256;
+            registeredBufferCount = 1024;
+            registeredBufferSize = 2048;
+            multishotReceive = true;
+            sqPoll = false;
+            sqPollIdleMs = 1000;
+        }
+    };
 
-        /** @brief [Optional, Default: 10] TODO: Shaun. */ 
-        int                 rpLeafConnectTimeoutSecs;
+    static void to_json(nlohmann::json& j, const NetworkIoBackend& p)
+    {
+        j = nlohmann::json{
+            TOJSON_IMPL(type),
+            TOJSON_IMPL(queueDepth),
+            TOJSON_IMPL(registeredBufferCount),
+            TOJSON_IMPL(registeredBufferSize),
+            TOJSON_IMPL(multishotReceive),
+            TOJSON_IMPL(sqPoll),
+            TOJSON_IMPL(sqPollIdleMs)
+        };
+    }
+    static void from_json(const nlohmann::json& j, NetworkIoBackend& p)
+    {
+        p.clear();
+        getOptional<NetworkIoBackend::Type_t>("type", p.type, j, NetworkIoBackend::Type_t::ibtDefault);
+        getOptional<int>("queueDepth", p.queueDepth, j, 256);
+        getOptional<int>("registeredBufferCount", p.registeredBufferCount, j, 1024);
+        getOptional<int>("registeredBufferSize", p.registeredBufferSize, j, 2048);
+        getOptional<bool>("multishotReceive", p.multishotReceive, j, true);
+        getOptional<bool>("sqPoll", p.sqPoll, j, false);
+        getOptional<int>("sqPollIdleMs", p.sqPollIdleMs, j, 1000);
+    }
 
-        /** @brief [Optional, Default: 5000] TODO: Shaun. */ 
-        int                 maxReconnectPauseMs;
+    //-----------------------------------------------------------
+    JSON_SERIALIZED_CLASS(UdpBatching)
+    /**
+    * @brief Batched UDP I/O settings for multicast and unicast group sockets
+    * 
+    * Helper C++ class to serialize and de-serialize UdpBatching JSON 
+    * 
+    * When enabled on platforms that support it (currently Linux), the Engine reads datagrams with recvmmsg() and writes
+    * them with sendmmsg() so that a single system call moves up to @ref maxRxBatch or @ref maxTxBatch packets.  Outbound
+    * packets destined for multiple groups in the same processing cycle are also coalesced into a single sendmmsg() call.
+    * UDP generic segmentation and receive offload (UDP_SEGMENT / UDP_GRO) are used where the kernel provides them.  On
+    * other platforms, or if the kernel rejects a call, the Engine falls back to one datagram per system call.
+    * 
+    * GSO only helps when several datagrams for the same destination are ready at once - a single voice stream produces
+    * one per framing interval.  testing/mcastbatch measures all three methods.
+    * 
+    * NOTE: This is the configuration contract only.  Batched I/O needs an Engine build that implements it; the Engine
+    * binaries in bin/ ignore this object.
+    * 
+    * Example: @include[doc] examples/UdpBatching.json 
+    *    
+    * @see EnginePolicyNetworking 
+    */       
+    class UdpBatching : public ConfigurationObjectBase
+    {
+        IMPLEMENT_JSON_SERIALIZATION()
+        IMPLEMENT_JSON_DOCUMENTATION(UdpBatching)
+        
+    public:
+        /** @brief [Optional, Default: false] Enables batched UDP I/O. */
+        bool                enabled;
 
-        /** @brief [Optional, Default: 500] TODO: Shaun. */ 
-        int                 reconnectFailurePauseIncrementMs;
+        /** @brief [Optional, Default: 32] Maximum number of datagrams read per receive call. */
+        int                 maxRxBatch;
 
-        /** @brief [Optional, Default: 1000] TODO: Shaun. */ 
-        int                 sendFailurePauseMs;
+        /** @brief [Optional, Default: 32] Maximum number of datagrams written per send call. */
+        int                 maxTxBatch;
 
-        /** @brief [Optional, Default: 6000] TODO: Shaun. */ 
-        int                 rallypointRtTestIntervalMs;
-        bool                logRtpJitterBufferStats;
+        /** @brief [Optional, Default: true] Use UDP generic segmentation offload for runs of packets to the same destination. */
+        bool                enableGso;
 
-        EnginePolicyNetworking()
+        /** @brief [Optional, Default: true] Use UDP generic receive offload. */
+        bool                enableGro;
+
+        /** @brief [Optional, Default: 0] Interval at which per-socket batch-size statistics are logged.  0 disables logging. */
+        int                 logStatsIntervalMs;
+
+        UdpBatching()
         {
             clear();
         }
 
         void clear()
         {
-            defaultNic.clear();
-            maxOutputQueuePackets = 100;
+            enabled = false;
+            maxRxBatch = 32;
+            maxTxBatch = 32;
+            enableGso = true;
+            enableGro = true;
+            logStatsIntervalMs = 0;
+        }
+    };
+
+    static void to_json(nlohmann::json& j, const UdpBatching& p)
+    {
+        j = nlohmann::json{
+            TOJSON_IMPL(enabled),
+            TOJSON_IMPL(maxRxBatch),
+            TOJSON_IMPL(maxTxBatch),
+            TOJSON_IMPL(enableGso),
+            TOJSON_IMPL(enableGro),
+            TOJSON_IMPL(logStatsIntervalMs)
+        };
+    }
+    static void from_json(const nlohmann::json& j, UdpBatching& p)
+    {
+        p.clear();
+        getOptional<bool>("enabled", p.enabled, j, false);
+        getOptional<int>("maxRxBatch", p.maxRxBatch, j, 32);
+        getOptional<int>("maxTxBatch", p.maxTxBatch, j, 32);
+        getOptional<bool>("enableGso", p.enableGso, j, true);
+        getOptional<bool>("enableGro", p.enableGro, j, true);
+        getOptional<int>("logStatsIntervalMs", p.logStatsIntervalMs, j, 0);
+    }
+
+    //-----------------------------------------------------------
+    JSON_SERIALIZED_CLASS(TxSchedulerQueue)
+    /**
+    * @brief Configuration of one priority class of the transmit scheduler
+    * 
+    * Helper C++ class to serialize and de-serialize TxSchedulerQueue JSON 
+    * 
+    * Example: @include[doc] examples/TxSchedulerQueue.json 
+    *    
+    * @see TxScheduler 
+    */       
+    class TxSchedulerQueue : public ConfigurationObjectBase
+    {
+        IMPLEMENT_JSON_SERIALIZATION()
+        IMPLEMENT_JSON_DOCUMENTATION(TxSchedulerQueue)
+        
+    public:
+        /** @brief [Optional, Default: priBestEffort] The packet priority serviced by this queue.  A queue that omits it becomes the priBestEffort queue.  See @ref NetworkTxOptions::TxPriority_t. */
+        NetworkTxOptions::TxPriority_t      priority;
+
+        /** @brief [Optional, Default: 100] Maximum number of packets held in this queue.  EnginePolicyNetworking::maxOutputQueuePackets still bounds all queues together - see @ref TxScheduler. */
+        int                                 maxPackets;
+
+        /** @brief [Optional, Default: false] If true, this queue is always serviced before any queue of lower priority.  Otherwise it shares the remaining capacity by deficit round-robin. */
+        bool                                strict;
+
+        /** @brief [Optional, Default: 1500] Bytes credited to this queue on each deficit round-robin round.  Ignored for strict queues. */
+        int                                 quantumBytes;
+
+        TxSchedulerQueue()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            priority = NetworkTxOptions::priBestEffort;
+            maxPackets = 100;
+            strict = false;
+            quantumBytes = 1500;
+        }
+    };
+
+    static void to_json(nlohmann::json& j, const TxSchedulerQueue& p)
+    {
+        j = nlohmann::json{
+            TOJSON_IMPL(priority),
+            TOJSON_IMPL(maxPackets),
+            TOJSON_IMPL(strict),
+            TOJSON_IMPL(quantumBytes)
+        };
+    }
+    static void from_json(const nlohmann::json& j, TxSchedulerQueue& p)
+    {
+        p.clear();
+        getOptional<NetworkTxOptions::TxPriority_t>("priority", p.priority, j, NetworkTxOptions::TxPriority_t::priBestEffort);
+        getOptional<int>("maxPackets", p.maxPackets, j, 100);
+        getOptional<bool>("strict", p.strict, j, false);
+        getOptional<int>("quantumBytes", p.quantumBytes, j, 1500);
+    }
+
+    //-----------------------------------------------------------
+    JSON_SERIALIZED_CLASS(TxScheduler)
+    /**
+    * @brief Priority-aware transmit scheduler settings
+    * 
+    * Helper C++ class to serialize and de-serialize TxScheduler JSON 
+    * 
+    * When enabled, outbound packets are placed in one queue per @ref NetworkTxOptions::TxPriority_t rather than in a single
+    * first-in-first-out queue.  Strict queues are drained first, in priority order; the remaining queues share what is left
+    * using deficit round-robin.  The upshot is that large transfers such as those started with @ref engageSendGroupBlob do
+    * not delay voice packets sharing the same Rallypoint link.
+    * 
+    * Both queue limits apply, and the lower one wins.  A packet is only queued if its own queue holds fewer than
+    * TxSchedulerQueue::maxPackets and the queues together hold fewer than @ref EnginePolicyNetworking::maxOutputQueuePackets:
+    * - If its own queue is full, the new packet is dropped, even if the total has room.  Other queues are not touched.
+    * - If its own queue has room but the total is full, the oldest packet of the lowest-priority non-empty queue is dropped
+    *   to make room, provided that queue is of lower priority than the new packet.  Otherwise the new packet is dropped.
+    * 
+    * The maxPackets of the queues may therefore add up to more than maxOutputQueuePackets; the global limit then decides
+    * which class gives way.
+    * 
+    * A TxSchedulerQueue without a priority is a priBestEffort queue.  If @ref queues has more than one entry for the same
+    * priority, the last one is used and the earlier ones are ignored.  Packets of a priority with no entry go to the
+    * priBestEffort queue, which is created with the TxSchedulerQueue defaults if it is not listed.  If @ref queues is
+    * empty, the Engine uses strict queues for priVoice and priSignaling and round-robin queues for priVideo and
+    * priBestEffort.
+    * 
+    * NOTE: Only the configuration contract is defined here.  The scheduler needs an Engine build that implements it; the
+    * Engine binaries in bin/ ignore this object and keep a single first-in-first-out queue bounded by maxOutputQueuePackets.
+    * 
+    * Example: @include[doc] examples/TxScheduler.json 
+    *    
+    * @see EnginePolicyNetworking, NetworkTxOptions
+    */       
+    class TxScheduler : public ConfigurationObjectBase
+    {
+        IMPLEMENT_JSON_SERIALIZATION()
+        IMPLEMENT_JSON_DOCUMENTATION(TxScheduler)
+        
+    public:
+        /** @brief [Optional, Default: false] Enables the priority scheduler.  When disabled a single FIFO queue is used. */
+        bool                                enabled;
+
+        /** @brief [Optional] Per-priority queue configuration.  See @ref TxSchedulerQueue. */
+        std::vector<TxSchedulerQueue>       queues;
+
+        /** @brief [Optional, Default: 0] Interval at which per-queue delay histograms are logged.  0 disables logging. */
+        int                                 logQueueDelayHistogramsIntervalMs;
+
+        /** @brief [Optional] Upper bounds, in milliseconds, of the queue delay histogram buckets.  Defaults to 1, 5, 10, 20, 50, 100, 250, 500 and 1000. */
+        std::vector<int>                    queueDelayHistogramBucketsMs;
+
+        TxScheduler()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            enabled = false;
+            queues.clear();
+            logQueueDelayHistogramsIntervalMs = 0;
+            queueDelayHistogramBucketsMs.clear();
+        }
+
+        virtual void initForDocumenting()
+        {
+            clear();
+
+            TxSchedulerQueue q;
+
+            q.priority = NetworkTxOptions::priVoice;
+            q.strict = true;
+            queues.push_back(q);
+
+            q.priority = NetworkTxOptions::priSignaling;
+            q.maxPackets = 50;
+            queues.push_back(q);
+
+            q.priority = NetworkTxOptions::priVideo;
+            q.strict = false;
+            q.maxPackets = 100;
+            q.quantumBytes = 3000;
+            queues.push_back(q);
+
+            q.priority = NetworkTxOptions::priBestEffort;
+            q.quantumBytes = 1500;
+            queues.push_back(q);
+
+            queueDelayHistogramBucketsMs = {1, 5, 10, 20, 50, 100, 250, 500, 1000};
+        }
+    };
+
+    static void to_json(nlohmann::json& j, const TxScheduler& p)
+    {
+        j = nlohmann::json{
+            TOJSON_IMPL(enabled),
+            TOJSON_IMPL(queues),
+            TOJSON_IMPL(logQueueDelayHistogramsIntervalMs),
+            TOJSON_IMPL(queueDelayHistogramBucketsMs)
+        };
+    }
+    static void from_json(const nlohmann::json& j, TxScheduler& p)
+    {
+        p.clear();
+        getOptional<bool>("enabled", p.enabled, j, false);
+        getOptional<std::vector<TxSchedulerQueue>>("queues", p.queues, j);
+        getOptional<int>("logQueueDelayHistogramsIntervalMs", p.logQueueDelayHistogramsIntervalMs, j, 0);
+        getOptional<std::vector<int>>("queueDelayHistogramBucketsMs", p.queueDelayHistogramBucketsMs, j);
+    }
+
+    //-----------------------------------------------------------
+    JSON_SERIALIZED_CLASS(RallypointMultiplexing)
+    /**
+    * @brief Settings for carrying many groups over a single Rallypoint connection
+    * 
+    * Helper C++ class to serialize and de-serialize RallypointMultiplexing JSON 
+    * 
+    * When enabled in the Engine, all groups whose @ref Group::rallypoints entries have the same @ref Rallypoint::host and
+    * present the same certificate share one TLS connection to that Rallypoint.  Each group is assigned a lightweight stream
+    * id on that connection, and traffic for each stream is governed by credit-based flow control so that one busy group
+    * cannot starve the others.  When enabled in the Rallypoint server, it accepts and grants credit to multiplexed streams.
+    * If either side does not support multiplexing, the Engine is to fall back to one connection per group.
+    * 
+    * NOTE: Only the configuration and negotiation contract is defined here.  The Engine and Rallypoint binaries in bin/
+    * do not implement multiplexing and ignore this object.
+    * 
+    * Example: @include[doc] examples/RallypointMultiplexing.json 
+    *    
+    * @see EnginePolicyNetworking, RallypointServer 
+    */       
+    class RallypointMultiplexing : public ConfigurationObjectBase
+    {
+        IMPLEMENT_JSON_SERIALIZATION()
+        IMPLEMENT_JSON_DOCUMENTATION(RallypointMultiplexing)
+        
+    public:
+        /** @brief [Optional, Default: false] Enables multiplexing of groups over a shared Rallypoint connection. */
+        bool                enabled;
+
+        /** @brief [Optional, Default: 0] Maximum number of group streams on one connection before another connection is opened.  0 means no limit. */
+        int                 maxStreamsPerConnection;
+
+        /** @brief [Optional, Default: 65536] Credit, in bytes, granted to each stream when it is opened. */
+        int                 initialStreamCreditBytes;
+
+        /** @brief [Optional, Default: 50] Percentage of a stream's credit that must be consumed before a credit update is sent. */
+        int                 creditUpdateThresholdPercentage;
+
+        RallypointMultiplexing()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            enabled = false;
+            maxStreamsPerConnection = 0;
+            initialStreamCreditBytes = 65536;
+            creditUpdateThresholdPercentage = 50;
+        }
+    };
+
+    static void to_json(nlohmann::json& j, const RallypointMultiplexing& p)
+    {
+        j = nlohmann::json{
+            TOJSON_IMPL(enabled),
+            TOJSON_IMPL(maxStreamsPerConnection),
+            TOJSON_IMPL(initialStreamCreditBytes),
+            TOJSON_IMPL(creditUpdateThresholdPercentage)
+        };
+    }
+    static void from_json(const nlohmann::json& j, RallypointMultiplexing& p)
+    {
+        p.clear();
+        getOptional<bool>("enabled", p.enabled, j, false);
+        getOptional<int>("maxStreamsPerConnection", p.maxStreamsPerConnection, j, 0);
+        getOptional<int>("initialStreamCreditBytes", p.initialStreamCreditBytes, j, 65536);
+        getOptional<int>("creditUpdateThresholdPercentage", p.creditUpdateThresholdPercentage, j, 50);
+    }
+
+    //-----------------------------------------------------------
+    JSON_SERIALIZED_CLASS(EnginePolicyNetworking)
+    /**
+    * @brief TODO: Shaun, can you document this class please 
+    * 
+    * Helper C++ class to serialize and de-serialize EnginePolicyNetworking JSON 
+    * 
+    * Example: @include[doc] examples/EnginePolicyNetworking.json 
+    *    
+    * @see TODO: Add references 
+    */       
+    class EnginePolicyNetworking : public ConfigurationObjectBase
+    {
+        IMPLEMENT_JSON_SERIALIZATION()
+        IMPLEMENT_JSON_DOCUMENTATION(EnginePolicyNetworking)
+        
+    public:
+        /** @brief Rallypoint reconnect backoff strategies. */
+        typedef enum
+        {
+            /** @brief The pause grows by @ref reconnectFailurePauseIncrementMs after each failure, up to @ref maxReconnectPauseMs */
+            rbLinear                = 0,
+
+            /** @brief Each pause is drawn at random between @ref minReconnectPauseMs and three times the previous pause, capped at @ref maxReconnectPauseMs */
+            rbDecorrelatedJitter    = 1
+        } ReconnectBackoff_t;
+
+
+        /** @brief This is the default netork interface card the Engage Engine should bind to. TODO: Shaun */ 
+        std::string         defaultNic;
+
+        /** @brief [Optional, Default: 100] TODO: Shaun. */ 
+        int                 maxOutputQueuePackets;
+
+        /** @brief [Optional, Default: 100] TODO: Shaun. */ 
+        int                 rtpJitterMinMs;
+
+        int                 rtpJitterMaxFactor;
+
+        /** @brief [Optional, Default: 1000] TODO: Shaun. */ 
+        int                 rtpJitterMaxMs;
+
+        /** @brief [Optional, Default: 5] TODO: Shaun. */ 
+        int                 rtpLatePacketSequenceRange;
+
+        int                 rtpJitterOverflowTrimPercentage;
+        int                 rtpJitterUnderrunReductionThresholdMs;
+
+        /** @brief [Optional, Default: 2000] TODO: Shaun. */ 
+        int                 rtpLatePacketTimestampRangeMs;
+
+        /** @brief [Optional, Default: 500] TODO: Shaun. */ 
+        int                 rtpInboundProcessorInactivityMs;
+
+        /** @brief [Optional, Default: 8] TODO: Shaun. */ 
+        int                 multicastRejoinSecs;
+
+        /** @brief [Optional, Default: 10] TODO: Shaun. */ 
+        int                 rpLeafConnectTimeoutSecs;
+
+        /** @brief [Optional, Default: 5000] TODO: Shaun. */ 
+        int                 maxReconnectPauseMs;
+
+        /** @brief [Optional, Default: 500] TODO: Shaun. */ 
+        int                 reconnectFailurePauseIncrementMs;
+
+        /** 
+         * @brief [Optional, Default: @ref rbLinear] How the pause between Rallypoint reconnect attempts grows.  See @ref ReconnectBackoff_t.
+         * 
+         * Decorrelated jitter spreads the reconnects of many Engines over time so that a restarted Rallypoint is not hit by
+         * all of its clients at once.  It is what spreads clients out when a Rallypoint sheds handshake load by closing new
+         * connections (see @ref RallypointAdmissionControl).
+         * 
+         * NOTE: Requires an Engine that implements rbDecorrelatedJitter.  The Engine binaries in bin/ ignore this setting and
+         * always back off linearly.
+         */ 
+        ReconnectBackoff_t  reconnectBackoff;
+
+        /** @brief [Optional, Default: 500] The shortest pause between reconnect attempts when using @ref rbDecorrelatedJitter.  Requires an Engine that implements it. */ 
+        int                 minReconnectPauseMs;
+
+        /** @brief [Optional, Default: 1000] TODO: Shaun. */ 
+        int                 sendFailurePauseMs;
+
+        /** @brief [Optional, Default: 6000] TODO: Shaun. */ 
+        int                 rallypointRtTestIntervalMs;
+        bool                logRtpJitterBufferStats;
+
+        /** @brief [Optional] Batched UDP send and receive.  Requires an Engine that supports batched I/O.  See @ref UdpBatching. */
+        UdpBatching         udpBatching;
+
+        /** @brief [Optional] The socket I/O backend.  Backends other than the default require an Engine that implements them.  See @ref NetworkIoBackend. */
+        NetworkIoBackend    ioBackend;
+
+        /** 
+         * @brief [Optional, Default: false] Share a single receive socket among groups with the same multicast address.
+         * 
+         * When enabled, all groups whose @ref Group::interfaceName, @ref Group::rx address and port are the same are serviced
+         * by one socket and one multicast membership.  Each datagram is read from the kernel once and then handed, in user space,
+         * to the group(s) whose stream it belongs to based on the RTP SSRC and the node id carried in the header extension.
+         * 
+         * NOTE: Requires an Engine that implements shared receive sockets.  The Engine binaries in bin/ ignore this setting
+         * and open one socket per group.
+         */
+        bool                shareMulticastSockets;
+
+        /** @brief [Optional] Priority-aware scheduling of the output queue.  Requires an Engine that implements the scheduler.  See @ref TxScheduler. */
+        TxScheduler         txScheduler;
+
+        /** @brief [Optional] Sharing of Rallypoint connections between groups.  Requires an Engine that supports multiplexing.  See @ref RallypointMultiplexing. */
+        RallypointMultiplexing  rallypointMultiplexing;
+
+        EnginePolicyNetworking()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            defaultNic.clear();
+            maxOutputQueuePackets = 100;
             rtpJitterMinMs = 100;
             rtpJitterMaxFactor = 8;
             rtpJitterOverflowTrimPercentage = 10;
@@ -2748,9 +3639,16 @@ namespace ConfigurationObjects
             rpLeafConnectTimeoutSecs = 10;
             maxReconnectPauseMs = 5000;
             reconnectFailurePauseIncrementMs = 500;
+            reconnectBackoff = rbLinear;
+            minReconnectPauseMs = 500;
             sendFailurePauseMs = 1000;
             rallypointRtTestIntervalMs = 60000;
             logRtpJitterBufferStats = false;
+            udpBatching.clear();
+            ioBackend.clear();
+            shareMulticastSockets = false;
+            txScheduler.clear();
+            rallypointMultiplexing.clear();
         }
     };
 
@@ -2770,9 +3668,16 @@ namespace ConfigurationObjects
             TOJSON_IMPL(rpLeafConnectTimeoutSecs),
             TOJSON_IMPL(maxReconnectPauseMs),
             TOJSON_IMPL(reconnectFailurePauseIncrementMs),
+            TOJSON_IMPL(reconnectBackoff),
+            TOJSON_IMPL(minReconnectPauseMs),
             TOJSON_IMPL(sendFailurePauseMs),
             TOJSON_IMPL(rallypointRtTestIntervalMs),
-            TOJSON_IMPL(logRtpJitterBufferStats)
+            TOJSON_IMPL(logRtpJitterBufferStats),
+            TOJSON_IMPL(udpBatching),
+            TOJSON_IMPL(ioBackend),
+            TOJSON_IMPL(shareMulticastSockets),
+            TOJSON_IMPL(txScheduler),
+            TOJSON_IMPL(rallypointMultiplexing)
         };
     }
     static void from_json(const nlohmann::json& j, EnginePolicyNetworking& p)
@@ -2791,9 +3696,16 @@ namespace ConfigurationObjects
         FROMJSON_IMPL(rpLeafConnectTimeoutSecs, int, 10);
         FROMJSON_IMPL(maxReconnectPauseMs, int, 5000);
         FROMJSON_IMPL(reconnectFailurePauseIncrementMs, int, 500);
+        getOptional<EnginePolicyNetworking::ReconnectBackoff_t>("reconnectBackoff", p.reconnectBackoff, j, EnginePolicyNetworking::ReconnectBackoff_t::rbLinear);
+        getOptional<int>("minReconnectPauseMs", p.minReconnectPauseMs, j, 500);
         FROMJSON_IMPL(sendFailurePauseMs, int, 1000);
         FROMJSON_IMPL(rallypointRtTestIntervalMs, int, 60000);
         FROMJSON_IMPL(logRtpJitterBufferStats, bool, false);
+        getOptional<UdpBatching>("udpBatching", p.udpBatching, j);
+        getOptional<NetworkIoBackend>("ioBackend", p.ioBackend, j);
+        getOptional<bool>("shareMulticastSockets", p.shareMulticastSockets, j, false);
+        getOptional<TxScheduler>("txScheduler", p.txScheduler, j);
+        getOptional<RallypointMultiplexing>("rallypointMultiplexing", p.rallypointMultiplexing, j);
     }           
 
 
@@ -2835,6 +3747,9 @@ namespace ConfigurationObjects
         /** @brief [Optional, Default: false] TODO: Shaun. */ 
         bool                allowOutputOnTransmit;
 
+        /** @brief [Optional, Default: false] Log the frames captured, suppressed and thinned by the @ref Vad, and the resulting suppression ratio, at the end of each transmission.  Requires an Engine that supports VAD. */
+        bool                logVadStats;
+
 
         EnginePolicyAudio()
         {
@@ -2856,6 +3771,7 @@ namespace ConfigurationObjects
 
             outputGainPercentage = 0;
             allowOutputOnTransmit = false;
+            logVadStats = false;
         }
     };
 
@@ -2872,7 +3788,8 @@ namespace ConfigurationObjects
             TOJSON_IMPL(outputRate),
             TOJSON_IMPL(outputChannels),
             TOJSON_IMPL(outputGainPercentage),
-            TOJSON_IMPL(allowOutputOnTransmit)
+            TOJSON_IMPL(allowOutputOnTransmit),
+            TOJSON_IMPL(logVadStats)
         };
     }
     static void from_json(const nlohmann::json& j, EnginePolicyAudio& p)
@@ -2891,6 +3808,7 @@ namespace ConfigurationObjects
 
         FROMJSON_IMPL(outputGainPercentage, int, 0);
         FROMJSON_IMPL(allowOutputOnTransmit, bool, false);
+        FROMJSON_IMPL(logVadStats, bool, false);
     }           
 
     //-----------------------------------------------------------
@@ -2963,52 +3881,153 @@ namespace ConfigurationObjects
         }      
     }           
     
-    // This is where spell checking stops
-    //----------------------------------------------------------- 
-    JSON_SERIALIZED_CLASS(EnginePolicySecurity)
-
+    //-----------------------------------------------------------
+    JSON_SERIALIZED_CLASS(TlsSessionResumption)
     /**
-    * @brief Default certificate to use for security operation in the Engage Engine.  
+    * @brief TLS session resumption settings
     * 
-    * For example .... TODO: Shaun, can you please provide examples
+    * Helper C++ class to serialize and de-serialize TlsSessionResumption JSON 
     * 
-    * Helper C++ class to serialize and de-serialize EnginePolicySecurity JSON 
+    * Session resumption allows a reconnect to skip the certificate exchange and key agreement of a full TLS handshake,
+    * saving both CPU and round trips.  On the connecting side (the Engine, or a Rallypoint connecting to its peers) sessions
+    * are cached per Rallypoint host and, if @ref cacheFileName is set, saved to disk so that they survive a restart.  On the
+    * accepting side (the Rallypoint server) the settings control the issuing of session tickets or session IDs.
     * 
-    * Example: @include[doc] examples/EnginePolicySecurity.json 
+    * TLS 1.3 early data (0-RTT) is only used when @ref allowEarlyData is set, and then only to carry the link registration
+    * which is safe to replay.  Media, blobs and other traffic are never sent as early data.
+    * 
+    * NOTE: This object defines configuration only.  Resumption needs Engine and Rallypoint builds that implement it; the
+    * binaries in bin/ ignore it and perform a full handshake on every connection.
+    * 
+    * Example: @include[doc] examples/TlsSessionResumption.json 
     *    
-    * @see ConfigurationObjects::EnginePolicy
+    * @see EnginePolicySecurity, Tls
     */       
-    class EnginePolicySecurity : public ConfigurationObjectBase
+    class TlsSessionResumption : public ConfigurationObjectBase
     {
         IMPLEMENT_JSON_SERIALIZATION()
-        IMPLEMENT_JSON_DOCUMENTATION(EnginePolicySecurity)
+        IMPLEMENT_JSON_DOCUMENTATION(TlsSessionResumption)
         
     public:
+        /** @brief [Optional, Default: false] Enables session resumption. */ 
+        bool                enabled;
 
-        /** @brief TODO: Shaun, is this optional as I recall there is a built in CERT the engine uses ... should we document that?? */ 
-        SecurityCertificate     certificate;
+        /** @brief [Optional, Default: true] Use stateless session tickets.  If false, server-side session IDs are used. */ 
+        bool                useSessionTickets;
 
-        EnginePolicySecurity()
+        /** @brief [Optional, Default: 7200] Number of seconds for which a session may be resumed. */ 
+        int                 sessionLifetimeSecs;
+
+        /** @brief [Optional, Default: 1024] Maximum number of sessions held in the cache. */ 
+        int                 maxCachedSessions;
+
+        /** @brief [Optional, Default: 3600] Interval at which the server rotates its session ticket encryption keys. */ 
+        int                 ticketKeyRotationSecs;
+
+        /** @brief [Optional, Default: false] Allows TLS 1.3 early data (0-RTT) for the link registration. */ 
+        bool                allowEarlyData;
+
+        /** 
+         * @brief [Optional, Default: empty] File in which to persist the client-side session cache.
+         * 
+         * For the Engine, a relative name is resolved against @ref EnginePolicy::dataDirectory.  If empty, the cache is
+         * held in memory only.  The file contains session secrets and is created readable only by the owning user.
+         */ 
+        std::string         cacheFileName;
+
+        TlsSessionResumption()
         {
             clear();
         }
 
         void clear()
         {
-            certificate.clear();
+            enabled = false;
+            useSessionTickets = true;
+            sessionLifetimeSecs = 7200;
+            maxCachedSessions = 1024;
+            ticketKeyRotationSecs = 3600;
+            allowEarlyData = false;
+            cacheFileName.clear();
         }
     };
 
-    static void to_json(nlohmann::json& j, const EnginePolicySecurity& p)
+    static void to_json(nlohmann::json& j, const TlsSessionResumption& p)
     {
         j = nlohmann::json{
-            TOJSON_IMPL(certificate),
+            TOJSON_IMPL(enabled),
+            TOJSON_IMPL(useSessionTickets),
+            TOJSON_IMPL(sessionLifetimeSecs),
+            TOJSON_IMPL(maxCachedSessions),
+            TOJSON_IMPL(ticketKeyRotationSecs),
+            TOJSON_IMPL(allowEarlyData),
+            TOJSON_IMPL(cacheFileName)
+        };
+    }
+    static void from_json(const nlohmann::json& j, TlsSessionResumption& p)
+    {
+        p.clear();
+        getOptional<bool>("enabled", p.enabled, j, false);
+        getOptional<bool>("useSessionTickets", p.useSessionTickets, j, true);
+        getOptional<int>("sessionLifetimeSecs", p.sessionLifetimeSecs, j, 7200);
+        getOptional<int>("maxCachedSessions", p.maxCachedSessions, j, 1024);
+        getOptional<int>("ticketKeyRotationSecs", p.ticketKeyRotationSecs, j, 3600);
+        getOptional<bool>("allowEarlyData", p.allowEarlyData, j, false);
+        getOptional<std::string>("cacheFileName", p.cacheFileName, j, EMPTY_STRING);
+    }
+
+    // This is where spell checking stops
+    //----------------------------------------------------------- 
+    JSON_SERIALIZED_CLASS(EnginePolicySecurity)
+
+    /**
+    * @brief Default certificate to use for security operation in the Engage Engine.  
+    * 
+    * For example .... TODO: Shaun, can you please provide examples
+    * 
+    * Helper C++ class to serialize and de-serialize EnginePolicySecurity JSON 
+    * 
+    * Example: @include[doc] examples/EnginePolicySecurity.json 
+    *    
+    * @see ConfigurationObjects::EnginePolicy
+    */       
+    class EnginePolicySecurity : public ConfigurationObjectBase
+    {
+        IMPLEMENT_JSON_SERIALIZATION()
+        IMPLEMENT_JSON_DOCUMENTATION(EnginePolicySecurity)
+        
+    public:
+
+        /** @brief TODO: Shaun, is this optional as I recall there is a built in CERT the engine uses ... should we document that?? */ 
+        SecurityCertificate     certificate;
+
+        /** @brief [Optional] Resumption of TLS sessions when reconnecting to Rallypoints.  Requires an Engine that supports resumption.  See @ref TlsSessionResumption. */
+        TlsSessionResumption    tlsSessionResumption;
+
+        EnginePolicySecurity()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            certificate.clear();
+            tlsSessionResumption.clear();
+        }
+    };
+
+    static void to_json(nlohmann::json& j, const EnginePolicySecurity& p)
+    {
+        j = nlohmann::json{
+            TOJSON_IMPL(certificate),
+            TOJSON_IMPL(tlsSessionResumption)
         };
     }
     static void from_json(const nlohmann::json& j, EnginePolicySecurity& p)
     {
         p.clear();
         getOptional("certificate", p.certificate, j);
+        getOptional("tlsSessionResumption", p.tlsSessionResumption, j);
     }           
 
     //-----------------------------------------------------------
@@ -3789,337 +4808,1155 @@ namespace ConfigurationObjects
     * @brief TODO: Complete class 
     * TODO: Shaun, can you please complete
     * 
-    * Helper C++ class to serialize and de-serialize TalkgroupAsset JSON 
+    * Helper C++ class to serialize and de-serialize TalkgroupAsset JSON 
+    * 
+    * Example: @include[doc] examples/TalkgroupAsset.json 
+    *    
+    * @see TODO: Add references 
+    */       
+    class TalkgroupAsset : public ConfigurationObjectBase
+    {
+        IMPLEMENT_JSON_SERIALIZATION()
+        IMPLEMENT_JSON_DOCUMENTATION(TalkgroupAsset)
+        
+    public:
+
+        /** @brief TODO: Shaun, can you please complete */
+        std::string     nodeId;
+
+        /** @brief TODO: Shaun, can you please complete */
+        Group           group;
+
+        TalkgroupAsset()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            nodeId.clear();
+            group.clear();
+        }
+    };
+    
+    static void to_json(nlohmann::json& j, const TalkgroupAsset& p)
+    {
+        j = nlohmann::json{
+            TOJSON_IMPL(nodeId),
+            TOJSON_IMPL(group)
+        };
+    }
+    static void from_json(const nlohmann::json& j, TalkgroupAsset& p)
+    {
+        p.clear();
+        getOptional<std::string>("nodeId", p.nodeId, j);
+        getOptional<Group>("group", p.group, j);
+    }
+
+    //-----------------------------------------------------------
+    JSON_SERIALIZED_CLASS(EngageDiscoveredGroup)
+    /**
+    * @brief TODO: Complete class 
+    * TODO: Shaun, can you please complete
+    * 
+    * Helper C++ class to serialize and de-serialize EngageDiscoveredGroup JSON 
+    * 
+    * Example: @include[doc] examples/EngageDiscoveredGroup.json 
+    *    
+    * @see TODO: Add references 
+    */       
+    class EngageDiscoveredGroup : public ConfigurationObjectBase
+    {
+        IMPLEMENT_JSON_SERIALIZATION()
+        IMPLEMENT_JSON_DOCUMENTATION(EngageDiscoveredGroup)
+        
+    public:
+        std::string     id;
+        int             type;
+        NetworkAddress  rx;
+        NetworkAddress  tx;
+
+        EngageDiscoveredGroup()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            id.clear();
+            type = 0;
+            rx.clear();
+            tx.clear();
+        }
+    };
+    
+    static void to_json(nlohmann::json& j, const EngageDiscoveredGroup& p)
+    {
+        j = nlohmann::json{
+            TOJSON_IMPL(id),
+            TOJSON_IMPL(type),
+            TOJSON_IMPL(rx),
+            TOJSON_IMPL(tx)
+        };
+    }
+    static void from_json(const nlohmann::json& j, EngageDiscoveredGroup& p)
+    {
+        p.clear();
+        getOptional<std::string>("id", p.id, j);
+        getOptional<int>("type", p.type, j, 0);
+        getOptional<NetworkAddress>("rx", p.rx, j);
+        getOptional<NetworkAddress>("tx", p.tx, j);
+    }
+
+    //-----------------------------------------------------------
+    JSON_SERIALIZED_CLASS(RallypointPeer)
+    /**
+    * @brief TODO: Shaun, is this even needed to be documented? 
+    * 
+    * Helper C++ class to serialize and de-serialize RallypointPeer JSON 
+    * 
+    * Example: @include[doc] examples/RallypointPeer.json 
+    *    
+    * @see RallypointServer  
+    */       
+    class RallypointPeer : public ConfigurationObjectBase
+    {
+        IMPLEMENT_JSON_SERIALIZATION()
+        IMPLEMENT_JSON_DOCUMENTATION(RallypointPeer)
+        
+    public:
+        std::string             id;
+        bool                    enabled;
+        NetworkAddress          host;
+        SecurityCertificate     certificate;
+
+        /** @brief [Optional, Default: 1] Cost of the link to this peer when RallypointMeshRouting::costMetric is lcmConfigured.  Requires a Rallypoint that supports mesh routing. */
+        int                     linkCost;
+
+        RallypointPeer()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            id.clear();
+            enabled = true;
+            host.clear();
+            certificate.clear();
+            linkCost = 1;
+        }
+    };
+
+    static void to_json(nlohmann::json& j, const RallypointPeer& p)
+    {
+        j = nlohmann::json{
+            TOJSON_IMPL(id),
+            TOJSON_IMPL(enabled),
+            TOJSON_IMPL(host),
+            TOJSON_IMPL(certificate),
+            TOJSON_IMPL(linkCost)
+        };
+    }
+    static void from_json(const nlohmann::json& j, RallypointPeer& p)
+    {
+        p.clear();
+        j.at("id").get_to(p.id);
+        getOptional<bool>("enabled", p.enabled, j, true);
+        getOptional<NetworkAddress>("host", p.host, j);
+        getOptional<SecurityCertificate>("certificate", p.certificate, j);
+        getOptional<int>("linkCost", p.linkCost, j, 1);
+    }
+
+    //-----------------------------------------------------------
+    JSON_SERIALIZED_CLASS(RallypointServerStatusReport)
+    /**
+    * @brief TODO: Configuration for the Rallypoint status report file
+    * 
+    * Helper C++ class to serialize and de-serialize RallypointServerStatusReport JSON 
+    * 
+    * Example: @include[doc] examples/RallypointServerStatusReport.json 
+    *    
+    * @see RallypointServer  
+    */       
+    class RallypointServerStatusReport : public ConfigurationObjectBase
+    {
+        IMPLEMENT_JSON_SERIALIZATION()
+        IMPLEMENT_JSON_DOCUMENTATION(RallypointServerStatusReport)
+
+    public:
+        /** File name to use for the Rally Point report. */
+        std::string                     fileName;
+
+        /** [Optional, Default: 30] The interval at which to write out the status report to file. */
+        int                             intervalSecs;
+        bool                            enabled;
+        bool                            includeLinks;
+        bool                            includePeerLinkDetails;
+        bool                            includeClientLinkDetails;
+
+        /** @brief [Optional, Default: false] Include per I/O pool load counters - links owned, connections accepted, packets and bytes processed, and cross-pool hand-offs.  Requires a Rallypoint that implements I/O pool sharding. */
+        bool                            includeIoPoolDetails;
+
+        /** @brief [Optional, Default: false] Include each link's TLS kernel offload state - offloaded, user-space, or the reason offload was not possible.  Requires a Rallypoint that supports TLS kernel offload. */
+        bool                            includeTlsOffloadStatus;
+
+        /** @brief [Optional, Default: false] Include per-link counts of packets dropped by ingress rate limits and by egress queue overflow, by traffic class.  Requires a Rallypoint that implements traffic control. */
+        bool                            includeDropCounters;
+
+        RallypointServerStatusReport()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            fileName.clear();
+            intervalSecs = 60;
+            enabled = false;
+            includeLinks = false;
+            includePeerLinkDetails = false;
+            includeClientLinkDetails = false;
+            includeIoPoolDetails = false;
+            includeTlsOffloadStatus = false;
+            includeDropCounters = false;
+        }
+    };
+    
+    static void to_json(nlohmann::json& j, const RallypointServerStatusReport& p)
+    {
+        j = nlohmann::json{
+            TOJSON_IMPL(fileName),
+            TOJSON_IMPL(intervalSecs),
+            TOJSON_IMPL(enabled),
+            TOJSON_IMPL(includeLinks),
+            TOJSON_IMPL(includePeerLinkDetails),
+            TOJSON_IMPL(includeClientLinkDetails),
+            TOJSON_IMPL(includeIoPoolDetails),
+            TOJSON_IMPL(includeTlsOffloadStatus),
+            TOJSON_IMPL(includeDropCounters)
+        };
+    }
+    static void from_json(const nlohmann::json& j, RallypointServerStatusReport& p)
+    {
+        p.clear();
+        getOptional<std::string>("fileName", p.fileName, j);
+        getOptional<int>("intervalSecs", p.intervalSecs, j, 60);
+        getOptional<bool>("enabled", p.enabled, j, false);
+        getOptional<bool>("includeLinks", p.includeLinks, j, false);
+        getOptional<bool>("includePeerLinkDetails", p.includePeerLinkDetails, j, false);
+        getOptional<bool>("includeClientLinkDetails", p.includeClientLinkDetails, j, false);
+        getOptional<bool>("includeIoPoolDetails", p.includeIoPoolDetails, j, false);
+        getOptional<bool>("includeTlsOffloadStatus", p.includeTlsOffloadStatus, j, false);
+        getOptional<bool>("includeDropCounters", p.includeDropCounters, j, false);
+    }    
+
+    //-----------------------------------------------------------
+    JSON_SERIALIZED_CLASS(RallypointServerLinkGraph)
+    class RallypointServerLinkGraph : public ConfigurationObjectBase
+    {
+        IMPLEMENT_JSON_SERIALIZATION()
+        IMPLEMENT_JSON_DOCUMENTATION(RallypointServerLinkGraph)
+
+    public:
+        /** @brief How the .dot file is produced */
+        typedef enum
+        {
+            /** @brief Written whenever the graph changes, no more often than every minRefreshSecs */
+            rmOnChange = 0,
+
+            /** @brief Only rendered when requested with "GET /linkgraph" on the health check port - see RallypointMetricsEndpoint */
+            rmOnDemand = 1
+        } RenderMode_t;
+
+        std::string                     fileName;
+        int                             minRefreshSecs;
+        bool                            enabled;
+        bool                            includeDigraphEnclosure;
+        bool                            includeClients;
+        std::string                     coreRpStyling;
+        std::string                     leafRpStyling;
+        std::string                     clientStyling;
+
+        /** @brief [Optional, Default: rmOnChange] How the .dot file is produced.  rmOnDemand requires a Rallypoint that keeps the graph in memory and implements the metrics endpoint; the rallypointd binaries in bin/ always behave as rmOnChange. */
+        RenderMode_t                    renderMode;
+
+        /** @brief [Optional] File to append each change to the graph to, one JSON object per line (sequence, operation, node or edge), restarting from a full snapshot whenever the .dot file is rewritten.  Requires a Rallypoint that supports link graph deltas; the rallypointd binaries in bin/ do not write this file. */
+        std::string                     deltaFileName;
+
+        RallypointServerLinkGraph()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            fileName.clear();
+            minRefreshSecs = 5;
+            enabled = false;
+            includeDigraphEnclosure = true;
+            includeClients = true;
+            coreRpStyling = "[shape=hexagon color=firebrick style=filled]";
+            leafRpStyling = "[shape=box color=gray style=filled]";
+            clientStyling.clear();
+            renderMode = rmOnChange;
+            deltaFileName.clear();
+        }
+    };
+    
+    static void to_json(nlohmann::json& j, const RallypointServerLinkGraph& p)
+    {
+        j = nlohmann::json{
+            TOJSON_IMPL(fileName),
+            TOJSON_IMPL(minRefreshSecs),
+            TOJSON_IMPL(enabled),
+            TOJSON_IMPL(includeDigraphEnclosure),
+            TOJSON_IMPL(includeClients),
+            TOJSON_IMPL(coreRpStyling),
+            TOJSON_IMPL(leafRpStyling),
+            TOJSON_IMPL(clientStyling),
+            TOJSON_IMPL(renderMode),
+            TOJSON_IMPL(deltaFileName)
+        };
+    }
+    static void from_json(const nlohmann::json& j, RallypointServerLinkGraph& p)
+    {
+        p.clear();
+        getOptional<std::string>("fileName", p.fileName, j);
+        getOptional<int>("minRefreshSecs", p.minRefreshSecs, j, 5);
+        getOptional<bool>("enabled", p.enabled, j, false);
+        getOptional<bool>("includeDigraphEnclosure", p.includeDigraphEnclosure, j, true);
+        getOptional<bool>("includeClients", p.includeClients, j, true);
+        getOptional<std::string>("coreRpStyling", p.coreRpStyling, j, "[shape=hexagon color=firebrick style=filled]");
+        getOptional<std::string>("leafRpStyling", p.leafRpStyling, j, "[shape=box color=gray style=filled]");
+        getOptional<std::string>("clientStyling", p.clientStyling, j);        
+        getOptional<RallypointServerLinkGraph::RenderMode_t>("renderMode", p.renderMode, j, RallypointServerLinkGraph::RenderMode_t::rmOnChange);
+        getOptional<std::string>("deltaFileName", p.deltaFileName, j);
+    }    
+
+    //-----------------------------------------------------------
+    JSON_SERIALIZED_CLASS(RallypointExternalHealthCheckResponder)
+    /**
+    * @brief TODO: Configuration to enable external systems to use to check if the service is still running. TODO: Shaun, can you please expand. 
+    * 
+    * Helper C++ class to serialize and de-serialize RallypointExternalHealthCheckResponder JSON 
+    * 
+    * Example: @include[doc] examples/RallypointExternalHealthCheckResponder.json 
+    *    
+    * @see RallypointServer 
+    */       
+    class RallypointExternalHealthCheckResponder : public ConfigurationObjectBase
+    {
+        IMPLEMENT_JSON_SERIALIZATION()
+        IMPLEMENT_JSON_DOCUMENTATION(RallypointExternalHealthCheckResponder)
+
+    public:
+
+        /** The network port to listen on for connections */
+        int                             listenPort;
+
+        /** TODO: Shaun, please complete */
+        bool                            immediateClose;
+
+        RallypointExternalHealthCheckResponder()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            listenPort = 0;
+            immediateClose = true;
+        }
+    };
+    
+    static void to_json(nlohmann::json& j, const RallypointExternalHealthCheckResponder& p)
+    {
+        j = nlohmann::json{
+            TOJSON_IMPL(listenPort),
+            TOJSON_IMPL(immediateClose)
+        };
+    }
+    static void from_json(const nlohmann::json& j, RallypointExternalHealthCheckResponder& p)
+    {
+        p.clear();
+        getOptional<int>("listenPort", p.listenPort, j, 0);
+        getOptional<bool>("immediateClose", p.immediateClose, j, true);
+    }    
+
+
+    //-----------------------------------------------------------
+    JSON_SERIALIZED_CLASS(RallypointMetricsEndpoint)
+    /**
+    * @brief Configuration for serving live Rallypoint metrics on demand
+    * 
+    * Helper C++ class to serialize and de-serialize RallypointMetricsEndpoint JSON 
+    * 
+    * With the endpoint, the Rallypoint keeps its counters up to date as events happen rather than gathering them when a
+    * report is due, and serves them whenever they are asked for.  They can be served in two places:
+    * - A Unix domain socket at @ref unixSocketPath.  Each connection is answered with a snapshot in @ref format.  A binary
+    *   request may carry the sequence number of the last snapshot the caller received, in which case only the counters
+    *   that have changed since then are returned.
+    * - The @ref RallypointServer::externalHealthCheckResponder port, when @ref serveOnHealthCheckPort is set.  An HTTP
+    *   "GET /metrics" there is answered in Prometheus text format.  If the link graph's render mode is
+    *   RallypointServerLinkGraph::rmOnDemand, "GET /linkgraph" there returns the link graph in Graphviz format.  Any other
+    *   connection gets the usual health check response.
+    * 
+    * This can take the place of the periodic @ref RallypointServerStatusReport file.
+    * 
+    * NOTE: Only the configuration contract is defined here.  The socket, the binary format and the HTTP paths need a
+    * Rallypoint build that implements the metrics endpoint; the rallypointd binaries in bin/ ignore this object, so keep
+    * the status report enabled with them.
+    * 
+    * Example: @include[doc] examples/RallypointMetricsEndpoint.json 
+    *    
+    * @see RallypointServer 
+    */       
+    class RallypointMetricsEndpoint : public ConfigurationObjectBase
+    {
+        IMPLEMENT_JSON_SERIALIZATION()
+        IMPLEMENT_JSON_DOCUMENTATION(RallypointMetricsEndpoint)
+
+    public:
+        /** @brief Snapshot format served on the Unix socket */
+        typedef enum
+        {
+            /** @brief Prometheus text exposition format */
+            mfPrometheus = 0,
+
+            /** @brief Compact binary records of counter id and value, with support for deltas */
+            mfBinary = 1
+        } Format_t;
+
+        /** @brief [Optional, Default: false] Enables the metrics endpoint. */
+        bool                            enabled;
+
+        /** @brief [Optional] Path of the Unix domain socket to serve metrics on.  May include ${id}.  No socket is created if empty. */
+        std::string                     unixSocketPath;
+
+        /** @brief [Optional, Default: mfPrometheus] Format of the snapshots served on the Unix socket. */
+        Format_t                        format;
+
+        /** @brief [Optional, Default: false] Also answer "GET /metrics" on the external health check responder port. */
+        bool                            serveOnHealthCheckPort;
+
+        /** @brief [Optional, Default: true] Include per-link counters for peer links. */
+        bool                            includePeerLinkDetails;
+
+        /** @brief [Optional, Default: false] Include per-link counters for client links. */
+        bool                            includeClientLinkDetails;
+
+        RallypointMetricsEndpoint()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            enabled = false;
+            unixSocketPath.clear();
+            format = mfPrometheus;
+            serveOnHealthCheckPort = false;
+            includePeerLinkDetails = true;
+            includeClientLinkDetails = false;
+        }
+    };
+    
+    static void to_json(nlohmann::json& j, const RallypointMetricsEndpoint& p)
+    {
+        j = nlohmann::json{
+            TOJSON_IMPL(enabled),
+            TOJSON_IMPL(unixSocketPath),
+            TOJSON_IMPL(format),
+            TOJSON_IMPL(serveOnHealthCheckPort),
+            TOJSON_IMPL(includePeerLinkDetails),
+            TOJSON_IMPL(includeClientLinkDetails)
+        };
+    }
+    static void from_json(const nlohmann::json& j, RallypointMetricsEndpoint& p)
+    {
+        p.clear();
+        getOptional<bool>("enabled", p.enabled, j, false);
+        getOptional<std::string>("unixSocketPath", p.unixSocketPath, j);
+        getOptional<RallypointMetricsEndpoint::Format_t>("format", p.format, j, RallypointMetricsEndpoint::Format_t::mfPrometheus);
+        getOptional<bool>("serveOnHealthCheckPort", p.serveOnHealthCheckPort, j, false);
+        getOptional<bool>("includePeerLinkDetails", p.includePeerLinkDetails, j, true);
+        getOptional<bool>("includeClientLinkDetails", p.includeClientLinkDetails, j, false);
+    }    
+
+    //-----------------------------------------------------------
+    JSON_SERIALIZED_CLASS(RallypointMeshRouting)
+    /**
+    * @brief Routing of group traffic across a mesh of peered Rallypoints
+    * 
+    * Helper C++ class to serialize and de-serialize RallypointMeshRouting JSON 
+    * 
+    * When enabled, each Rallypoint advertises its peer links, and what each link costs, to its peers.  Every Rallypoint
+    * therefore holds the same view of the mesh.  From that view each Rallypoint computes, per group, either the
+    * shortest-path tree rooted at the Rallypoint where the group's traffic enters the mesh, or a single spanning tree
+    * shared by all groups.  Traffic is forwarded only along the edges of that tree to the peers that lead to registered
+    * clients.  No Rallypoint receives a packet twice and no packet returns to where it came from, so
+    * @ref RallypointServer::allowPeerForwarding can be used on meshes that contain loops.  Every packet also carries its
+    * origin and a hop count, and a packet that exceeds @ref maxHops is dropped.  This protects the mesh while Rallypoints
+    * briefly disagree about the topology after a change.
+    * 
+    * NOTE: Only the configuration contract is defined here.  Advertisements, tree computation and the origin/hop-count
+    * header need a Rallypoint build that implements mesh routing, on every Rallypoint in the mesh.  The rallypointd
+    * binaries in bin/ ignore this object and forward to peers as @ref RallypointServer::allowPeerForwarding says.
+    * 
+    * Example: @include[doc] examples/RallypointMeshRouting.json 
+    *    
+    * @see RallypointServer, RallypointPeer::linkCost
+    */       
+    class RallypointMeshRouting : public ConfigurationObjectBase
+    {
+        IMPLEMENT_JSON_SERIALIZATION()
+        IMPLEMENT_JSON_DOCUMENTATION(RallypointMeshRouting)
+
+    public:
+        /** @brief Tree computation */
+        typedef enum
+        {
+            /** @brief A shortest-path tree per group, rooted at the Rallypoint the group's traffic enters on */
+            mrtShortestPath = 0,
+
+            /** @brief One minimum spanning tree shared by all groups */
+            mrtSpanningTree = 1
+        } TreeType_t;
+
+        /** @brief How the cost of a peer link is measured */
+        typedef enum
+        {
+            /** @brief Every link costs 1 */
+            lcmHops = 0,
+
+            /** @brief The link's measured round-trip time */
+            lcmRtt = 1,
+
+            /** @brief The peer's configured RallypointPeer::linkCost */
+            lcmConfigured = 2
+        } LinkCostMetric_t;
+
+        /** @brief [Optional, Default: false] Enables tree-based forwarding between peers. */
+        bool                            enabled;
+
+        /** @brief [Optional, Default: mrtShortestPath] The kind of tree traffic is forwarded along. */
+        TreeType_t                      treeType;
+
+        /** @brief [Optional, Default: lcmHops] How peer link costs are measured. */
+        LinkCostMetric_t                costMetric;
+
+        /** @brief [Optional, Default: 30] Interval at which a Rallypoint re-advertises its peer links even if nothing has changed. */
+        int                             advertisementIntervalSecs;
+
+        /** @brief [Optional, Default: 25] With lcmRtt, the change in a link's RTT needed before the link is re-advertised. */
+        int                             rttChangeThresholdPercentage;
+
+        /** @brief [Optional, Default: 1000] Time to wait for further topology changes before trees are recomputed. */
+        int                             recomputeHoldDownMs;
+
+        /** @brief [Optional, Default: 16] Packets that have crossed this many peer links are dropped. */
+        int                             maxHops;
+
+        RallypointMeshRouting()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            enabled = false;
+            treeType = mrtShortestPath;
+            costMetric = lcmHops;
+            advertisementIntervalSecs = 30;
+            rttChangeThresholdPercentage = 25;
+            recomputeHoldDownMs = 1000;
+            maxHops = 16;
+        }
+    };
+    
+    static void to_json(nlohmann::json& j, const RallypointMeshRouting& p)
+    {
+        j = nlohmann::json{
+            TOJSON_IMPL(enabled),
+            TOJSON_IMPL(treeType),
+            TOJSON_IMPL(costMetric),
+            TOJSON_IMPL(advertisementIntervalSecs),
+            TOJSON_IMPL(rttChangeThresholdPercentage),
+            TOJSON_IMPL(recomputeHoldDownMs),
+            TOJSON_IMPL(maxHops)
+        };
+    }
+    static void from_json(const nlohmann::json& j, RallypointMeshRouting& p)
+    {
+        p.clear();
+        getOptional<bool>("enabled", p.enabled, j, false);
+        getOptional<RallypointMeshRouting::TreeType_t>("treeType", p.treeType, j, RallypointMeshRouting::TreeType_t::mrtShortestPath);
+        getOptional<RallypointMeshRouting::LinkCostMetric_t>("costMetric", p.costMetric, j, RallypointMeshRouting::LinkCostMetric_t::lcmHops);
+        getOptional<int>("advertisementIntervalSecs", p.advertisementIntervalSecs, j, 30);
+        getOptional<int>("rttChangeThresholdPercentage", p.rttChangeThresholdPercentage, j, 25);
+        getOptional<int>("recomputeHoldDownMs", p.recomputeHoldDownMs, j, 1000);
+        getOptional<int>("maxHops", p.maxHops, j, 16);
+    }    
+
+    //-----------------------------------------------------------
+    JSON_SERIALIZED_CLASS(RallypointIoPoolSharding)
+    /**
+    * @brief Settings for sharding the Rallypoint's connections across its I/O pools
+    * 
+    * Helper C++ class to serialize and de-serialize RallypointIoPoolSharding JSON 
+    * 
+    * When @ref listenerPerPool is set (Linux only), each of the @ref RallypointServer::ioPools opens its own listening socket
+    * on the same port using SO_REUSEPORT so that the kernel spreads incoming connections across the pools and no single
+    * accept loop limits connection throughput.  Each pool owns the links it accepts, keeps its own client table, and only
+    * hands packets to another pool when fanning out to links that pool owns.  Pools may also be pinned to CPU cores, in
+    * which case their memory is allocated on the NUMA node of their core.
+    * 
+    * NOTE: This object defines configuration only.  Sharding and pinning need a Rallypoint build that implements them;
+    * the rallypointd binaries in bin/ ignore it and accept every connection on a single listener.
+    * 
+    * Example: @include[doc] examples/RallypointIoPoolSharding.json 
+    *    
+    * @see RallypointServer 
+    */       
+    class RallypointIoPoolSharding : public ConfigurationObjectBase
+    {
+        IMPLEMENT_JSON_SERIALIZATION()
+        IMPLEMENT_JSON_DOCUMENTATION(RallypointIoPoolSharding)
+
+    public:
+        /** @brief [Optional, Default: false] Give each I/O pool its own SO_REUSEPORT listening socket. */
+        bool                            listenerPerPool;
+
+        /** @brief [Optional, Default: false] Pin each I/O pool's thread to a CPU core. */
+        bool                            pinToCpus;
+
+        /** @brief [Optional] CPU cores to pin the I/O pools to, in pool order.  If empty, pool N is pinned to core N. */
+        std::vector<int>                cpus;
+
+        /** @brief [Optional, Default: true] When pinned, allocate each pool's memory on the NUMA node of its core. */
+        bool                            numaLocalMemory;
+
+        RallypointIoPoolSharding()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            listenerPerPool = false;
+            pinToCpus = false;
+            cpus.clear();
+            numaLocalMemory = true;
+        }
+    };
+    
+    static void to_json(nlohmann::json& j, const RallypointIoPoolSharding& p)
+    {
+        j = nlohmann::json{
+            TOJSON_IMPL(listenerPerPool),
+            TOJSON_IMPL(pinToCpus),
+            TOJSON_IMPL(cpus),
+            TOJSON_IMPL(numaLocalMemory)
+        };
+    }
+    static void from_json(const nlohmann::json& j, RallypointIoPoolSharding& p)
+    {
+        p.clear();
+        getOptional<bool>("listenerPerPool", p.listenerPerPool, j, false);
+        getOptional<bool>("pinToCpus", p.pinToCpus, j, false);
+        getOptional<std::vector<int>>("cpus", p.cpus, j);
+        getOptional<bool>("numaLocalMemory", p.numaLocalMemory, j, true);
+    }    
+
+    //-----------------------------------------------------------
+    JSON_SERIALIZED_CLASS(RallypointAdmissionControl)
+    /**
+    * @brief Token-bucket admission control for new connections to the Rallypoint
+    * 
+    * Helper C++ class to serialize and de-serialize RallypointAdmissionControl JSON 
     * 
-    * Example: @include[doc] examples/TalkgroupAsset.json 
+    * Each newly accepted TCP connection consumes one token before its TLS handshake begins.  Tokens are replenished at
+    * @ref connectionsPerSecond up to @ref burst.  When no token is available the connection is closed straight away, before
+    * any handshake work is done.  Nothing at the application level can reach the client before the handshake, so no hint
+    * is given as to when to try again - the spread of returning clients comes from their own backoff (see
+    * EnginePolicyNetworking::reconnectBackoff with rbDecorrelatedJitter).  This lets a restarted Rallypoint shed handshake
+    * load and bring its clients back steadily instead of thrashing.
+    * 
+    * NOTE: Only the configuration contract is defined here.  It needs a Rallypoint build that implements admission control;
+    * the rallypointd binaries in bin/ ignore this object.
+    * 
+    * Example: @include[doc] examples/RallypointAdmissionControl.json 
     *    
-    * @see TODO: Add references 
+    * @see RallypointServer, EnginePolicyNetworking::reconnectBackoff
     */       
-    class TalkgroupAsset : public ConfigurationObjectBase
+    class RallypointAdmissionControl : public ConfigurationObjectBase
     {
         IMPLEMENT_JSON_SERIALIZATION()
-        IMPLEMENT_JSON_DOCUMENTATION(TalkgroupAsset)
-        
+        IMPLEMENT_JSON_DOCUMENTATION(RallypointAdmissionControl)
+
     public:
+        /** @brief [Optional, Default: false] Enables admission control. */
+        bool                            enabled;
 
-        /** @brief TODO: Shaun, can you please complete */
-        std::string     nodeId;
+        /** @brief [Optional, Default: 100] Rate at which new connections are admitted. */
+        int                             connectionsPerSecond;
 
-        /** @brief TODO: Shaun, can you please complete */
-        Group           group;
+        /** @brief [Optional, Default: 500] Maximum number of connections admitted in a burst. */
+        int                             burst;
 
-        TalkgroupAsset()
+        /** @brief [Optional, Default: true] Connections from the addresses of configured peers are always admitted.  The check is by source address because the peer's certificate is not known until the handshake. */
+        bool                            exemptPeers;
+
+        RallypointAdmissionControl()
         {
             clear();
         }
 
         void clear()
         {
-            nodeId.clear();
-            group.clear();
+            enabled = false;
+            connectionsPerSecond = 100;
+            burst = 500;
+            exemptPeers = true;
         }
     };
     
-    static void to_json(nlohmann::json& j, const TalkgroupAsset& p)
+    static void to_json(nlohmann::json& j, const RallypointAdmissionControl& p)
     {
         j = nlohmann::json{
-            TOJSON_IMPL(nodeId),
-            TOJSON_IMPL(group)
+            TOJSON_IMPL(enabled),
+            TOJSON_IMPL(connectionsPerSecond),
+            TOJSON_IMPL(burst),
+            TOJSON_IMPL(exemptPeers)
         };
     }
-    static void from_json(const nlohmann::json& j, TalkgroupAsset& p)
+    static void from_json(const nlohmann::json& j, RallypointAdmissionControl& p)
     {
         p.clear();
-        getOptional<std::string>("nodeId", p.nodeId, j);
-        getOptional<Group>("group", p.group, j);
-    }
+        getOptional<bool>("enabled", p.enabled, j, false);
+        getOptional<int>("connectionsPerSecond", p.connectionsPerSecond, j, 100);
+        getOptional<int>("burst", p.burst, j, 500);
+        getOptional<bool>("exemptPeers", p.exemptPeers, j, true);
+    }    
 
     //-----------------------------------------------------------
-    JSON_SERIALIZED_CLASS(EngageDiscoveredGroup)
+    JSON_SERIALIZED_CLASS(RallypointTokenBucket)
     /**
-    * @brief TODO: Complete class 
-    * TODO: Shaun, can you please complete
+    * @brief A token-bucket rate limit
     * 
-    * Helper C++ class to serialize and de-serialize EngageDiscoveredGroup JSON 
+    * Helper C++ class to serialize and de-serialize RallypointTokenBucket JSON 
     * 
-    * Example: @include[doc] examples/EngageDiscoveredGroup.json 
+    * Packets are admitted while both the packet and byte buckets hold tokens.  The buckets refill at @ref packetsPerSecond
+    * and @ref bytesPerSecond, and each holds at most @ref burstMs worth of its rate.  A rate of 0 is not limited.
+    * 
+    * Example: @include[doc] examples/RallypointTokenBucket.json 
     *    
-    * @see TODO: Add references 
+    * @see RallypointTrafficControl 
     */       
-    class EngageDiscoveredGroup : public ConfigurationObjectBase
+    class RallypointTokenBucket : public ConfigurationObjectBase
     {
         IMPLEMENT_JSON_SERIALIZATION()
-        IMPLEMENT_JSON_DOCUMENTATION(EngageDiscoveredGroup)
-        
+        IMPLEMENT_JSON_DOCUMENTATION(RallypointTokenBucket)
+
     public:
-        std::string     id;
-        int             type;
-        NetworkAddress  rx;
-        NetworkAddress  tx;
+        /** @brief [Optional, Default: false] Enables the limit. */
+        bool                            enabled;
 
-        EngageDiscoveredGroup()
+        /** @brief [Optional, Default: 0] Sustained packets per second. */
+        int                             packetsPerSecond;
+
+        /** @brief [Optional, Default: 0] Sustained bytes per second. */
+        int                             bytesPerSecond;
+
+        /** @brief [Optional, Default: 1000] Size of the buckets, expressed as this many milliseconds at the sustained rates. */
+        int                             burstMs;
+
+        RallypointTokenBucket()
         {
             clear();
         }
 
         void clear()
         {
-            id.clear();
-            type = 0;
-            rx.clear();
-            tx.clear();
+            enabled = false;
+            packetsPerSecond = 0;
+            bytesPerSecond = 0;
+            burstMs = 1000;
         }
     };
     
-    static void to_json(nlohmann::json& j, const EngageDiscoveredGroup& p)
+    static void to_json(nlohmann::json& j, const RallypointTokenBucket& p)
     {
         j = nlohmann::json{
-            TOJSON_IMPL(id),
-            TOJSON_IMPL(type),
-            TOJSON_IMPL(rx),
-            TOJSON_IMPL(tx)
+            TOJSON_IMPL(enabled),
+            TOJSON_IMPL(packetsPerSecond),
+            TOJSON_IMPL(bytesPerSecond),
+            TOJSON_IMPL(burstMs)
         };
     }
-    static void from_json(const nlohmann::json& j, EngageDiscoveredGroup& p)
+    static void from_json(const nlohmann::json& j, RallypointTokenBucket& p)
     {
         p.clear();
-        getOptional<std::string>("id", p.id, j);
-        getOptional<int>("type", p.type, j, 0);
-        getOptional<NetworkAddress>("rx", p.rx, j);
-        getOptional<NetworkAddress>("tx", p.tx, j);
-    }
+        getOptional<bool>("enabled", p.enabled, j, false);
+        getOptional<int>("packetsPerSecond", p.packetsPerSecond, j, 0);
+        getOptional<int>("bytesPerSecond", p.bytesPerSecond, j, 0);
+        getOptional<int>("burstMs", p.burstMs, j, 1000);
+    }    
 
     //-----------------------------------------------------------
-    JSON_SERIALIZED_CLASS(RallypointPeer)
+    JSON_SERIALIZED_CLASS(RallypointTrafficControl)
     /**
-    * @brief TODO: Shaun, is this even needed to be documented? 
+    * @brief Ingress rate limiting and egress fair queuing for Rallypoint links
     * 
-    * Helper C++ class to serialize and de-serialize RallypointPeer JSON 
+    * Helper C++ class to serialize and de-serialize RallypointTrafficControl JSON 
     * 
-    * Example: @include[doc] examples/RallypointPeer.json 
+    * On ingress, each client link is held to @ref clientIngress, and the traffic from each client on each group is held
+    * to @ref groupIngress.  Packets over either limit are dropped before they are forwarded.  Only blob and raw traffic
+    * is limited unless @ref limitVoice is set.
+    * 
+    * On egress, when @ref fairQueuing is enabled, each link's outbound traffic is queued by class (voice, control and
+    * data) and served by weighted fair queuing.  A burst of blobs can therefore not delay the voice behind it by more than
+    * its share.  A link whose queues exceed @ref maxEgressQueueBytes drops data first, then control, then voice.
+    * 
+    * Drops are counted per link and per reason, and shown in the status report when
+    * RallypointServerStatusReport::includeDropCounters is set.
+    * 
+    * NOTE: Only the configuration contract is defined here.  Rate limiting, fair queuing and the drop counters need a
+    * Rallypoint build that implements traffic control; the rallypointd binaries in bin/ ignore this object and forward
+    * everything they receive.
+    * 
+    * Example: @include[doc] examples/RallypointTrafficControl.json 
     *    
-    * @see RallypointServer  
+    * @see RallypointServer, RallypointTokenBucket 
     */       
-    class RallypointPeer : public ConfigurationObjectBase
+    class RallypointTrafficControl : public ConfigurationObjectBase
     {
         IMPLEMENT_JSON_SERIALIZATION()
-        IMPLEMENT_JSON_DOCUMENTATION(RallypointPeer)
-        
+        IMPLEMENT_JSON_DOCUMENTATION(RallypointTrafficControl)
+
     public:
-        std::string             id;
-        bool                    enabled;
-        NetworkAddress          host;
-        SecurityCertificate     certificate;
+        /** @brief [Optional] Limit on all limited traffic received from each client link. */
+        RallypointTokenBucket           clientIngress;
 
-        RallypointPeer()
+        /** @brief [Optional] Limit on limited traffic received from each client link for any one group. */
+        RallypointTokenBucket           groupIngress;
+
+        /** @brief [Optional, Default: false] Apply the ingress limits to voice as well as to blob and raw traffic. */
+        bool                            limitVoice;
+
+        /** @brief [Optional, Default: true] Do not apply the ingress limits to peer Rallypoint links. */
+        bool                            exemptPeers;
+
+        /** @brief [Optional, Default: false] Enables weighted fair queuing on egress. */
+        bool                            fairQueuing;
+
+        /** @brief [Optional, Default: 8] Egress weight of voice traffic. */
+        int                             voiceWeight;
+
+        /** @brief [Optional, Default: 4] Egress weight of control traffic (registrations, presence and keepalives). */
+        int                             controlWeight;
+
+        /** @brief [Optional, Default: 1] Egress weight of blob and raw traffic. */
+        int                             dataWeight;
+
+        /** @brief [Optional, Default: 262144] Most bytes that may be queued for a link before its traffic is dropped. */
+        int                             maxEgressQueueBytes;
+
+        RallypointTrafficControl()
         {
             clear();
         }
 
         void clear()
         {
-            id.clear();
-            enabled = true;
-            host.clear();
-            certificate.clear();
+            clientIngress.clear();
+            groupIngress.clear();
+            limitVoice = false;
+            exemptPeers = true;
+            fairQueuing = false;
+            voiceWeight = 8;
+            controlWeight = 4;
+            dataWeight = 1;
+            maxEgressQueueBytes = 262144;
         }
     };
-
-    static void to_json(nlohmann::json& j, const RallypointPeer& p)
+    
+    static void to_json(nlohmann::json& j, const RallypointTrafficControl& p)
     {
         j = nlohmann::json{
-            TOJSON_IMPL(id),
-            TOJSON_IMPL(enabled),
-            TOJSON_IMPL(host),
-            TOJSON_IMPL(certificate)
+            TOJSON_IMPL(clientIngress),
+            TOJSON_IMPL(groupIngress),
+            TOJSON_IMPL(limitVoice),
+            TOJSON_IMPL(exemptPeers),
+            TOJSON_IMPL(fairQueuing),
+            TOJSON_IMPL(voiceWeight),
+            TOJSON_IMPL(controlWeight),
+            TOJSON_IMPL(dataWeight),
+            TOJSON_IMPL(maxEgressQueueBytes)
         };
     }
-    static void from_json(const nlohmann::json& j, RallypointPeer& p)
+    static void from_json(const nlohmann::json& j, RallypointTrafficControl& p)
     {
         p.clear();
-        j.at("id").get_to(p.id);
-        getOptional<bool>("enabled", p.enabled, j, true);
-        getOptional<NetworkAddress>("host", p.host, j);
-        getOptional<SecurityCertificate>("certificate", p.certificate, j);
-    }
+        getOptional<RallypointTokenBucket>("clientIngress", p.clientIngress, j);
+        getOptional<RallypointTokenBucket>("groupIngress", p.groupIngress, j);
+        getOptional<bool>("limitVoice", p.limitVoice, j, false);
+        getOptional<bool>("exemptPeers", p.exemptPeers, j, true);
+        getOptional<bool>("fairQueuing", p.fairQueuing, j, false);
+        getOptional<int>("voiceWeight", p.voiceWeight, j, 8);
+        getOptional<int>("controlWeight", p.controlWeight, j, 4);
+        getOptional<int>("dataWeight", p.dataWeight, j, 1);
+        getOptional<int>("maxEgressQueueBytes", p.maxEgressQueueBytes, j, 262144);
+    }    
 
     //-----------------------------------------------------------
-    JSON_SERIALIZED_CLASS(RallypointServerStatusReport)
+    JSON_SERIALIZED_CLASS(RallypointDrain)
     /**
-    * @brief TODO: Configuration for the Rallypoint status report file
+    * @brief Settings for draining a Rallypoint ahead of a restart or upgrade
     * 
-    * Helper C++ class to serialize and de-serialize RallypointServerStatusReport JSON 
+    * Helper C++ class to serialize and de-serialize RallypointDrain JSON 
     * 
-    * Example: @include[doc] examples/RallypointServerStatusReport.json 
+    * A drain is started by sending SIGUSR2 to the Rallypoint.  SIGTERM and SIGINT still shut down immediately.  While
+    * draining, the Rallypoint stops accepting new clients.  If @ref migrateClients is set, connected clients are told to
+    * move to the next entry in their Group::rallypoints list.  These directives are spread over @ref migrationSpreadMs so
+    * that the other Rallypoints aren't hit all at once, and a client only moves a group once no talk-spurt is active on
+    * it.  The Rallypoint exits when its last client has gone, or when @ref timeoutSecs has passed.
+    * 
+    * If @ref handOffSocketPath is set, a newly-started Rallypoint can connect to that Unix socket and have the listening
+    * sockets passed to it using SCM_RIGHTS.  This means connections are never refused during a binary upgrade.
+    * 
+    * With @ref handOffOffloadedLinks, established links can be handed over too, together with their registrations, but
+    * only links the new process can carry on from the socket alone.  That means the TLS session must be offloaded to the
+    * kernel in both directions (TlsKernelOffload::offloadTx and TlsKernelOffload::offloadRx), and the link must hold no
+    * keys derived from the session's exporter secret - no UDP media keys (see UdpMediaTransport) and no session HMAC keys
+    * (@ref RallypointServer::messageAuthentication set to Rallypoint::maSessionHmac).  Those secrets only exist in the
+    * old process.  For the same reason the new process cannot answer a TLS KeyUpdate on a handed-over link, nor issue
+    * session tickets for it; such a link is closed when its peer sends a KeyUpdate and the client reconnects with a full
+    * handshake.  Every other link migrates as usual.
+    * 
+    * NOTE: Only the configuration contract is defined here.  Draining, migration and hand-off need a Rallypoint build that
+    * implements them; the rallypointd binaries in bin/ ignore this object and SIGUSR2.
+    * 
+    * Example: @include[doc] examples/RallypointDrain.json 
     *    
-    * @see RallypointServer  
+    * @see RallypointServer 
     */       
-    class RallypointServerStatusReport : public ConfigurationObjectBase
+    class RallypointDrain : public ConfigurationObjectBase
     {
         IMPLEMENT_JSON_SERIALIZATION()
-        IMPLEMENT_JSON_DOCUMENTATION(RallypointServerStatusReport)
+        IMPLEMENT_JSON_DOCUMENTATION(RallypointDrain)
 
     public:
-        /** File name to use for the Rally Point report. */
-        std::string                     fileName;
+        /** @brief [Optional, Default: 300] Longest time a drain may take before the Rallypoint exits regardless. */
+        int                             timeoutSecs;
 
-        /** [Optional, Default: 30] The interval at which to write out the status report to file. */
-        int                             intervalSecs;
-        bool                            enabled;
-        bool                            includeLinks;
-        bool                            includePeerLinkDetails;
-        bool                            includeClientLinkDetails;
+        /** @brief [Optional, Default: true] Tell connected clients to move to another Rallypoint. */
+        bool                            migrateClients;
 
-        RallypointServerStatusReport()
+        /** @brief [Optional, Default: 10000] Period over which migration directives are spread across the connected clients. */
+        int                             migrationSpreadMs;
+
+        /** @brief [Optional] Unix socket on which a replacement Rallypoint process can collect the listening sockets.  May include ${id}.  No hand-off is offered if empty. */
+        std::string                     handOffSocketPath;
+
+        /** @brief [Optional, Default: false] Also hand over established links, with their registrations, if their TLS is offloaded to the kernel in both directions and they hold no keys derived from the TLS session.  See the class description for what is excluded. */
+        bool                            handOffOffloadedLinks;
+
+        RallypointDrain()
         {
             clear();
         }
 
         void clear()
         {
-            fileName.clear();
-            intervalSecs = 60;
-            enabled = false;
-            includeLinks = false;
-            includePeerLinkDetails = false;
-            includeClientLinkDetails = false;
+            timeoutSecs = 300;
+            migrateClients = true;
+            migrationSpreadMs = 10000;
+            handOffSocketPath.clear();
+            handOffOffloadedLinks = false;
         }
     };
     
-    static void to_json(nlohmann::json& j, const RallypointServerStatusReport& p)
+    static void to_json(nlohmann::json& j, const RallypointDrain& p)
     {
         j = nlohmann::json{
-            TOJSON_IMPL(fileName),
-            TOJSON_IMPL(intervalSecs),
-            TOJSON_IMPL(enabled),
-            TOJSON_IMPL(includeLinks),
-            TOJSON_IMPL(includePeerLinkDetails),
-            TOJSON_IMPL(includeClientLinkDetails)
+            TOJSON_IMPL(timeoutSecs),
+            TOJSON_IMPL(migrateClients),
+            TOJSON_IMPL(migrationSpreadMs),
+            TOJSON_IMPL(handOffSocketPath),
+            TOJSON_IMPL(handOffOffloadedLinks)
         };
     }
-    static void from_json(const nlohmann::json& j, RallypointServerStatusReport& p)
+    static void from_json(const nlohmann::json& j, RallypointDrain& p)
     {
         p.clear();
-        getOptional<std::string>("fileName", p.fileName, j);
-        getOptional<int>("intervalSecs", p.intervalSecs, j, 60);
-        getOptional<bool>("enabled", p.enabled, j, false);
-        getOptional<bool>("includeLinks", p.includeLinks, j, false);
-        getOptional<bool>("includePeerLinkDetails", p.includePeerLinkDetails, j, false);
-        getOptional<bool>("includeClientLinkDetails", p.includeClientLinkDetails, j, false);
+        getOptional<int>("timeoutSecs", p.timeoutSecs, j, 300);
+        getOptional<bool>("migrateClients", p.migrateClients, j, true);
+        getOptional<int>("migrationSpreadMs", p.migrationSpreadMs, j, 10000);
+        getOptional<std::string>("handOffSocketPath", p.handOffSocketPath, j);
+        getOptional<bool>("handOffOffloadedLinks", p.handOffOffloadedLinks, j, false);
     }    
 
     //-----------------------------------------------------------
-    JSON_SERIALIZED_CLASS(RallypointServerLinkGraph)
-    class RallypointServerLinkGraph : public ConfigurationObjectBase
+    JSON_SERIALIZED_CLASS(RallypointRegistrationSnapshot)
+    /**
+    * @brief Persisted registration state used to warm-start a Rallypoint
+    * 
+    * Helper C++ class to serialize and de-serialize RallypointRegistrationSnapshot JSON 
+    * 
+    * When enabled, the Rallypoint is to write a compact binary snapshot of its group registration tables and peer link
+    * state to @ref fileName every @ref intervalSecs and again on shutdown.  The file must be written to a temporary name
+    * and renamed into place so that a crash cannot leave a partial snapshot behind.
+    * 
+    * On start, the Rallypoint maps the snapshot into memory and pre-populates its routing from it, so that traffic can be
+    * forwarded to a restored registration as soon as its link comes back rather than after the registration wave that
+    * otherwise follows a restart.  Restored entries are stale until reconciled: a link that reconnects confirms or
+    * replaces its own entries, and entries still unconfirmed after @ref reconcileGraceSecs are dropped.  A snapshot older
+    * than @ref maxAgeSecs, or one written by a Rallypoint with a different id, is ignored.
+    * 
+    * NOTE: Only the configuration contract, not the snapshot format, is defined here.  Writing and restoring snapshots
+    * needs a Rallypoint build that implements them; the rallypointd binaries in bin/ ignore this object and start with
+    * empty registration tables.
+    * 
+    * Example: @include[doc] examples/RallypointRegistrationSnapshot.json 
+    *    
+    * @see RallypointServer 
+    */       
+    class RallypointRegistrationSnapshot : public ConfigurationObjectBase
     {
         IMPLEMENT_JSON_SERIALIZATION()
-        IMPLEMENT_JSON_DOCUMENTATION(RallypointServerLinkGraph)
+        IMPLEMENT_JSON_DOCUMENTATION(RallypointRegistrationSnapshot)
 
     public:
-        std::string                     fileName;
-        int                             minRefreshSecs;
+        /** @brief [Optional, Default: false] Persist and restore the registration snapshot. */
         bool                            enabled;
-        bool                            includeDigraphEnclosure;
-        bool                            includeClients;
-        std::string                     coreRpStyling;
-        std::string                     leafRpStyling;
-        std::string                     clientStyling;
 
-        RallypointServerLinkGraph()
+        /** @brief [Optional] Path of the snapshot file.  May include ${id}.  Required when enabled. */
+        std::string                     fileName;
+
+        /** @brief [Optional, Default: 30] Interval at which the snapshot is written while running.  0 writes it only on shutdown. */
+        int                             intervalSecs;
+
+        /** @brief [Optional, Default: 300] Snapshots older than this when the Rallypoint starts are ignored.  0 accepts a snapshot of any age. */
+        int                             maxAgeSecs;
+
+        /** @brief [Optional, Default: 60] Time a restored entry may remain unconfirmed by its link before it is dropped. */
+        int                             reconcileGraceSecs;
+
+        /** @brief [Optional, Default: true] Include the registrations learned from peers as well as those of clients. */
+        bool                            includePeerRegistrations;
+
+        RallypointRegistrationSnapshot()
         {
             clear();
         }
 
         void clear()
         {
-            fileName.clear();
-            minRefreshSecs = 5;
             enabled = false;
-            includeDigraphEnclosure = true;
-            includeClients = true;
-            coreRpStyling = "[shape=hexagon color=firebrick style=filled]";
-            leafRpStyling = "[shape=box color=gray style=filled]";
-            clientStyling.clear();
+            fileName.clear();
+            intervalSecs = 30;
+            maxAgeSecs = 300;
+            reconcileGraceSecs = 60;
+            includePeerRegistrations = true;
         }
     };
     
-    static void to_json(nlohmann::json& j, const RallypointServerLinkGraph& p)
+    static void to_json(nlohmann::json& j, const RallypointRegistrationSnapshot& p)
     {
         j = nlohmann::json{
-            TOJSON_IMPL(fileName),
-            TOJSON_IMPL(minRefreshSecs),
             TOJSON_IMPL(enabled),
-            TOJSON_IMPL(includeDigraphEnclosure),
-            TOJSON_IMPL(includeClients),
-            TOJSON_IMPL(coreRpStyling),
-            TOJSON_IMPL(leafRpStyling),
-            TOJSON_IMPL(clientStyling)
+            TOJSON_IMPL(fileName),
+            TOJSON_IMPL(intervalSecs),
+            TOJSON_IMPL(maxAgeSecs),
+            TOJSON_IMPL(reconcileGraceSecs),
+            TOJSON_IMPL(includePeerRegistrations)
         };
     }
-    static void from_json(const nlohmann::json& j, RallypointServerLinkGraph& p)
+    static void from_json(const nlohmann::json& j, RallypointRegistrationSnapshot& p)
     {
         p.clear();
-        getOptional<std::string>("fileName", p.fileName, j);
-        getOptional<int>("minRefreshSecs", p.minRefreshSecs, j, 5);
         getOptional<bool>("enabled", p.enabled, j, false);
-        getOptional<bool>("includeDigraphEnclosure", p.includeDigraphEnclosure, j, true);
-        getOptional<bool>("includeClients", p.includeClients, j, true);
-        getOptional<std::string>("coreRpStyling", p.coreRpStyling, j, "[shape=hexagon color=firebrick style=filled]");
-        getOptional<std::string>("leafRpStyling", p.leafRpStyling, j, "[shape=box color=gray style=filled]");
-        getOptional<std::string>("clientStyling", p.clientStyling, j);        
+        getOptional<std::string>("fileName", p.fileName, j);
+        getOptional<int>("intervalSecs", p.intervalSecs, j, 30);
+        getOptional<int>("maxAgeSecs", p.maxAgeSecs, j, 300);
+        getOptional<int>("reconcileGraceSecs", p.reconcileGraceSecs, j, 60);
+        getOptional<bool>("includePeerRegistrations", p.includePeerRegistrations, j, true);
     }    
 
     //-----------------------------------------------------------
-    JSON_SERIALIZED_CLASS(RallypointExternalHealthCheckResponder)
+    JSON_SERIALIZED_CLASS(TlsKernelOffload)
     /**
-    * @brief TODO: Configuration to enable external systems to use to check if the service is still running. TODO: Shaun, can you please expand. 
+    * @brief Hand-off of negotiated TLS sessions to the operating system kernel
     * 
-    * Helper C++ class to serialize and de-serialize RallypointExternalHealthCheckResponder JSON 
+    * Helper C++ class to serialize and de-serialize TlsKernelOffload JSON 
     * 
-    * Example: @include[doc] examples/RallypointExternalHealthCheckResponder.json 
+    * When enabled on Linux, the keys of each link's session are installed into the kernel (kTLS) once the handshake
+    * completes.  The kernel then frames and encrypts records on the socket itself, which takes record encryption off
+    * the forwarding threads.  It also lets a payload be forwarded to many links without a user-space copy per link.
+    * Offload only applies to ciphers the kernel supports (AES-128-GCM, AES-256-GCM and, on newer kernels,
+    * CHACHA20-POLY1305).  If the kernel lacks TLS support or the negotiated cipher isn't offloadable, the link is to stay
+    * on user-space TLS, with its offload state shown in the status report when
+    * RallypointServerStatusReport::includeTlsOffloadStatus is set.
+    * 
+    * NOTE: Only the configuration contract is defined here.  Offload, and the fallback to user-space TLS, need Rallypoint
+    * and Engine builds that implement kTLS; the binaries in bin/ ignore this object and always encrypt in user space.
+    * 
+    * Example: @include[doc] examples/TlsKernelOffload.json 
     *    
-    * @see RallypointServer 
+    * @see Tls 
     */       
-    class RallypointExternalHealthCheckResponder : public ConfigurationObjectBase
+    class TlsKernelOffload : public ConfigurationObjectBase
     {
         IMPLEMENT_JSON_SERIALIZATION()
-        IMPLEMENT_JSON_DOCUMENTATION(RallypointExternalHealthCheckResponder)
+        IMPLEMENT_JSON_DOCUMENTATION(TlsKernelOffload)
 
     public:
+        /** @brief [Optional, Default: false] Enables kernel TLS offload. */ 
+        bool                        enabled;
 
-        /** The network port to listen on for connections */
-        int                             listenPort;
+        /** @brief [Optional, Default: true] Offload transmit-side encryption. */ 
+        bool                        offloadTx;
 
-        /** TODO: Shaun, please complete */
-        bool                            immediateClose;
+        /** @brief [Optional, Default: true] Offload receive-side decryption. */ 
+        bool                        offloadRx;
 
-        RallypointExternalHealthCheckResponder()
+        /** @brief [Optional, Default: true] Prefer ciphers the kernel can offload when negotiating a session. */ 
+        bool                        preferOffloadableCiphers;
+
+        TlsKernelOffload()
         {
             clear();
         }
 
         void clear()
         {
-            listenPort = 0;
-            immediateClose = true;
+            enabled = false;
+            offloadTx = true;
+            offloadRx = true;
+            preferOffloadableCiphers = true;
         }
     };
     
-    static void to_json(nlohmann::json& j, const RallypointExternalHealthCheckResponder& p)
+    static void to_json(nlohmann::json& j, const TlsKernelOffload& p)
     {
         j = nlohmann::json{
-            TOJSON_IMPL(listenPort),
-            TOJSON_IMPL(immediateClose)
+            TOJSON_IMPL(enabled),
+            TOJSON_IMPL(offloadTx),
+            TOJSON_IMPL(offloadRx),
+            TOJSON_IMPL(preferOffloadableCiphers)
         };
     }
-    static void from_json(const nlohmann::json& j, RallypointExternalHealthCheckResponder& p)
+    static void from_json(const nlohmann::json& j, TlsKernelOffload& p)
     {
         p.clear();
-        getOptional<int>("listenPort", p.listenPort, j, 0);
-        getOptional<bool>("immediateClose", p.immediateClose, j, true);
+        getOptional<bool>("enabled", p.enabled, j, false);
+        getOptional<bool>("offloadTx", p.offloadTx, j, true);
+        getOptional<bool>("offloadRx", p.offloadRx, j, true);
+        getOptional<bool>("preferOffloadableCiphers", p.preferOffloadableCiphers, j, true);
     }    
 
-
     //-----------------------------------------------------------
     JSON_SERIALIZED_CLASS(Tls)
     /**
@@ -4128,6 +5965,11 @@ namespace ConfigurationObjects
     * 
     * Helper C++ class to serialize and de-serialize Tls JSON 
     * 
+    * NOTE: Only the configuration contract is defined here for the matching rules described on @ref whitelistedSubjects,
+    * @ref whitelistedIssuers, @ref blacklistedSubjects and @ref blacklistedIssuers: '*' prefix entries, exact matching
+    * otherwise, and the deny lists winning over the allow lists.  They need Rallypoint and Engine builds that implement
+    * them.  The binaries in bin/ were not changed for these rules and may match the lists differently.
+    * 
     * Example: @include[doc] examples/Tls.json 
     *    
     * @see RallypointServer 
@@ -4148,18 +5990,24 @@ namespace ConfigurationObjects
         /** @brief TODO: */ 
         std::vector<std::string>    caCertificates;
 
-        /** @brief TODO: */ 
+        /** @brief Certificate subjects that are accepted.  If not empty, any other subject is rejected.  An entry ending in '*' matches every subject that starts with the rest of the entry; any other entry must match exactly.  Requires a binary that implements these matching rules - see the NOTE on @ref Tls. */ 
         std::vector<std::string>    whitelistedSubjects;
 
-        /** @brief TODO: */ 
+        /** @brief Certificate issuers that are accepted.  If not empty, any other issuer is rejected.  Entries are matched as for whitelistedSubjects.  Requires a binary that implements these matching rules - see the NOTE on @ref Tls. */ 
         std::vector<std::string>    whitelistedIssuers;
 
-        /** @brief TODO: */ 
+        /** @brief Certificate subjects that are always rejected.  Entries are matched as for whitelistedSubjects.  Requires a binary that implements these matching rules - see the NOTE on @ref Tls. */ 
         std::vector<std::string>    blacklistedSubjects;
 
-        /** @brief TODO: */ 
+        /** @brief Certificate issuers that are always rejected.  Entries are matched as for whitelistedSubjects.  Requires a binary that implements these matching rules - see the NOTE on @ref Tls. */ 
         std::vector<std::string>    blacklistedIssuers;
 
+        /** @brief [Optional] Session resumption for links using these settings.  Requires a Rallypoint that supports resumption.  See @ref TlsSessionResumption. */ 
+        TlsSessionResumption        sessionResumption;
+
+        /** @brief [Optional] Kernel offload of record encryption for links using these settings.  Requires a binary that supports TLS kernel offload.  See @ref TlsKernelOffload. */ 
+        TlsKernelOffload            kernelOffload;
+
         Tls()
         {
             clear();
@@ -4174,6 +6022,8 @@ namespace ConfigurationObjects
             whitelistedIssuers.clear();
             blacklistedSubjects.clear();
             blacklistedIssuers.clear();
+            sessionResumption.clear();
+            kernelOffload.clear();
         }
     };
     
@@ -4186,7 +6036,9 @@ namespace ConfigurationObjects
             TOJSON_IMPL(whitelistedSubjects),
             TOJSON_IMPL(whitelistedIssuers),
             TOJSON_IMPL(blacklistedSubjects),
-            TOJSON_IMPL(blacklistedIssuers)
+            TOJSON_IMPL(blacklistedIssuers),
+            TOJSON_IMPL(sessionResumption),
+            TOJSON_IMPL(kernelOffload)
         };
     }
     static void from_json(const nlohmann::json& j, Tls& p)
@@ -4199,6 +6051,8 @@ namespace ConfigurationObjects
         getOptional<std::vector<std::string>>("whitelistedIssuers", p.whitelistedIssuers, j);
         getOptional<std::vector<std::string>>("blacklistedSubjects", p.blacklistedSubjects, j);
         getOptional<std::vector<std::string>>("blacklistedIssuers", p.blacklistedIssuers, j);
+        getOptional<TlsSessionResumption>("sessionResumption", p.sessionResumption, j);
+        getOptional<TlsKernelOffload>("kernelOffload", p.kernelOffload, j);
     }    
 
     //-----------------------------------------------------------
@@ -4307,18 +6161,27 @@ namespace ConfigurationObjects
         /** @brief X.509 certificate and private key that identifies the Rallypoint.  @see SecurityCertificate*/
         SecurityCertificate                         certificate;
 
-        /** @brief Name of a file containing a JSON array of Rallypoint peers to connect to. */
+        /** @brief Name of a file containing a JSON array of Rallypoint peers to connect to.  A Rallypoint that supports incremental peering updates compares peers by id when the file changes and only connects, disconnects or reconnects those added, removed or changed, leaving links to unchanged peers up.  The rallypointd binaries in bin/ do not compare peers this way. */
         std::string                                 peeringConfigurationFileName;
 
         /** @brief Number of seconds between checks to see if the peering configuration has been updated.  Default is 60.*/
         int                                         peeringConfigurationFileCheckSecs;
 
+        /** @brief Watch the peering configuration file for changes (inotify on Linux) rather than only checking it every peeringConfigurationFileCheckSecs, which then serves as a fallback.  Default is false.  Requires a Rallypoint that supports watching the peering file; the rallypointd binaries in bin/ ignore this setting and only poll. */
+        bool                                        watchPeeringConfigurationFile;
+
+        /** @brief Milliseconds to wait after a change notification for the file to stop changing before it is re-read.  Default is 500.  Only used with watchPeeringConfigurationFile. */
+        int                                         peeringConfigurationSettleMs;
+
         /** @brief Allows traffic received on unicast links to be forwarded to the multicast network. */
         bool                                        allowMulticastForwarding;
 
         /** @brief Number of threading pools to create for network I/O.  Default is -1 which creates 1 I/O pool per CPU core. */
         int                                         ioPools;
 
+        /** @brief How connections are distributed across the I/O pools and how the pools are placed on CPUs.  Requires a Rallypoint that implements I/O pool sharding.  @see RallypointIoPoolSharding */
+        RallypointIoPoolSharding                    ioPoolSharding;
+
         /** @brief Details for producing a status report. @see RallypointServerStatusReport */
         RallypointServerStatusReport                statusReport;
 
@@ -4328,6 +6191,9 @@ namespace ConfigurationObjects
         /** @brief Details concerning the Rallypoint's interaction with an external heal-checker such as a load-balancer.  @see RallypointExternalHealthCheckResponder */
         RallypointExternalHealthCheckResponder      externalHealthCheckResponder;
 
+        /** @brief Details for serving live metrics on demand.  Requires a Rallypoint that implements the metrics endpoint.  @see RallypointMetricsEndpoint */
+        RallypointMetricsEndpoint                   metrics;
+
         /** @brief Set to true to allow forwarding of packets received from other Rallypoints to all other Rallypoints.  *WARNING* Be exceptionally careful when enabling this capability! */
         bool                                        allowPeerForwarding;
 
@@ -4361,9 +6227,36 @@ namespace ConfigurationObjects
         /** @brief Set to true to forgo DSA signing of messages.  Doing so is is a security risk but can be useful on CPU-constrained systems on already-secure environments. */
         bool                                        disableMessageSigning;
 
+        /** @brief How control messages on client and peer links are authenticated when signing is not disabled.  With maSessionHmac, only messages that end at this Rallypoint or at the far end of the link use the HMAC; anything relayed to other Rallypoints stays signed, because a link HMAC does not authenticate a message's origin.  Requires a Rallypoint that supports session HMACs.  @see Rallypoint::MessageAuthentication_t */
+        Rallypoint::MessageAuthentication_t         messageAuthentication;
+
         /** @brief Indicates whether inbound peer registrations should be reciprocated.  Only applicable for a mesh leaf that has multicat forwarding enabled. */
         bool                                        reciprocateRegistrations;
 
+        /** @brief The socket I/O backend used for client, peer and multicast links.  Backends other than the default require a Rallypoint that implements them.  @see NetworkIoBackend */
+        NetworkIoBackend                            ioBackend;
+
+        /** @brief Acceptance of multiple group streams over a single client connection.  Requires a Rallypoint that supports multiplexing.  @see RallypointMultiplexing */
+        RallypointMultiplexing                      multiplexing;
+
+        /** @brief Acceptance of media over UDP from clients and peers.  Requires a Rallypoint that supports the UDP media transport.  @see UdpMediaTransport */
+        UdpMediaTransport                           udpMedia;
+
+        /** @brief Rate limiting of new connections.  Requires a Rallypoint that implements admission control.  @see RallypointAdmissionControl */
+        RallypointAdmissionControl                  admissionControl;
+
+        /** @brief Tree-based forwarding of traffic between peered Rallypoints.  Requires a Rallypoint that supports mesh routing.  @see RallypointMeshRouting */
+        RallypointMeshRouting                       meshRouting;
+
+        /** @brief Draining and hand-off of connections ahead of a restart.  Requires a Rallypoint that supports draining.  @see RallypointDrain */
+        RallypointDrain                             drain;
+
+        /** @brief Ingress rate limits and egress fair queuing on links.  Requires a Rallypoint that implements traffic control.  @see RallypointTrafficControl */
+        RallypointTrafficControl                    trafficControl;
+
+        /** @brief Persisted registration state used to warm-start after a restart.  Requires a Rallypoint that supports registration snapshots.  @see RallypointRegistrationSnapshot */
+        RallypointRegistrationSnapshot              registrationSnapshot;
+
         RallypointServer()
         {
             clear();
@@ -4380,10 +6273,14 @@ namespace ConfigurationObjects
             peeringConfiguration.clear();
             peeringConfigurationFileName.clear();
             peeringConfigurationFileCheckSecs = 60;
+            watchPeeringConfigurationFile = false;
+            peeringConfigurationSettleMs = 500;
             ioPools = -1;
+            ioPoolSharding.clear();
             statusReport.clear();
             linkGraph.clear();
             externalHealthCheckResponder.clear();
+            metrics.clear();
             allowPeerForwarding = false;
             multicastInterfaceName.clear();
             tls.clear();
@@ -4394,7 +6291,16 @@ namespace ConfigurationObjects
             watchdogIntervalMs = 5000;
             watchdogHangDetectionMs = 2000;
             disableMessageSigning = false;
+            messageAuthentication = Rallypoint::maSignature;
             reciprocateRegistrations = false;
+            ioBackend.clear();
+            multiplexing.clear();
+            udpMedia.clear();
+            admissionControl.clear();
+            meshRouting.clear();
+            drain.clear();
+            trafficControl.clear();
+            registrationSnapshot.clear();
         }
     };
     
@@ -4410,10 +6316,14 @@ namespace ConfigurationObjects
             // TOJSON_IMPL(peeringConfiguration),               // NOTE: Not serialized!
             TOJSON_IMPL(peeringConfigurationFileName),
             TOJSON_IMPL(peeringConfigurationFileCheckSecs),
+            TOJSON_IMPL(watchPeeringConfigurationFile),
+            TOJSON_IMPL(peeringConfigurationSettleMs),
             TOJSON_IMPL(ioPools),
+            TOJSON_IMPL(ioPoolSharding),
             TOJSON_IMPL(statusReport),
             TOJSON_IMPL(linkGraph),
             TOJSON_IMPL(externalHealthCheckResponder),
+            TOJSON_IMPL(metrics),
             TOJSON_IMPL(allowPeerForwarding),
             TOJSON_IMPL(multicastInterfaceName),
             TOJSON_IMPL(tls),
@@ -4424,7 +6334,16 @@ namespace ConfigurationObjects
             TOJSON_IMPL(watchdogIntervalMs),
             TOJSON_IMPL(watchdogHangDetectionMs),
             TOJSON_IMPL(disableMessageSigning),
-            TOJSON_IMPL(reciprocateRegistrations)
+            TOJSON_IMPL(messageAuthentication),
+            TOJSON_IMPL(reciprocateRegistrations),
+            TOJSON_IMPL(ioBackend),
+            TOJSON_IMPL(multiplexing),
+            TOJSON_IMPL(udpMedia),
+            TOJSON_IMPL(admissionControl),
+            TOJSON_IMPL(meshRouting),
+            TOJSON_IMPL(drain),
+            TOJSON_IMPL(trafficControl),
+            TOJSON_IMPL(registrationSnapshot)
         };
     }
     static void from_json(const nlohmann::json& j, RallypointServer& p)
@@ -4439,10 +6358,14 @@ namespace ConfigurationObjects
         //getOptional<PeeringConfiguration>("peeringConfiguration", p.peeringConfiguration, j);         // NOTE: Not serialized!    
         getOptional<std::string>("peeringConfigurationFileName", p.peeringConfigurationFileName, j);
         getOptional<int>("peeringConfigurationFileCheckSecs", p.peeringConfigurationFileCheckSecs, j, 60);
+        getOptional<bool>("watchPeeringConfigurationFile", p.watchPeeringConfigurationFile, j, false);
+        getOptional<int>("peeringConfigurationSettleMs", p.peeringConfigurationSettleMs, j, 500);
         getOptional<int>("ioPools", p.ioPools, j, -1);
+        getOptional<RallypointIoPoolSharding>("ioPoolSharding", p.ioPoolSharding, j);
         getOptional<RallypointServerStatusReport>("statusReport", p.statusReport, j);
         getOptional<RallypointServerLinkGraph>("linkGraph", p.linkGraph, j);
         getOptional<RallypointExternalHealthCheckResponder>("externalHealthCheckResponder", p.externalHealthCheckResponder, j);
+        getOptional<RallypointMetricsEndpoint>("metrics", p.metrics, j);
         getOptional<bool>("allowPeerForwarding", p.allowPeerForwarding, j, false);        
         getOptional<std::string>("multicastInterfaceName", p.multicastInterfaceName, j);
         getOptional<Tls>("clientTls", p.tls, j);
@@ -4453,7 +6376,16 @@ namespace ConfigurationObjects
         getOptional<int>("watchdogIntervalMs", p.watchdogIntervalMs, j, 5000);
         getOptional<int>("watchdogHangDetectionMs", p.watchdogHangDetectionMs, j, 2000);
         getOptional<bool>("disableMessageSigning", p.disableMessageSigning, j, false);
+        getOptional<Rallypoint::MessageAuthentication_t>("messageAuthentication", p.messageAuthentication, j, Rallypoint::MessageAuthentication_t::maSignature);
         getOptional<bool>("reciprocateRegistrations", p.reciprocateRegistrations, j, false);
+        getOptional<NetworkIoBackend>("ioBackend", p.ioBackend, j);
+        getOptional<RallypointMultiplexing>("multiplexing", p.multiplexing, j);
+        getOptional<UdpMediaTransport>("udpMedia", p.udpMedia, j);
+        getOptional<RallypointAdmissionControl>("admissionControl", p.admissionControl, j);
+        getOptional<RallypointMeshRouting>("meshRouting", p.meshRouting, j);
+        getOptional<RallypointDrain>("drain", p.drain, j);
+        getOptional<RallypointTrafficControl>("trafficControl", p.trafficControl, j);
+        getOptional<RallypointRegistrationSnapshot>("registrationSnapshot", p.registrationSnapshot, j);
     }    
 
     
@@ -4651,7 +6583,10 @@ namespace ConfigurationObjects
         PresenceDescriptor::document(path);
         NetworkTxOptions::document(path);
         NetworkAddress::document(path);
+        UdpMediaTransport::document(path);
         Rallypoint::document(path);
+        Vad::document(path);
+        AdaptivePacketization::document(path);
         TxAudio::document(path);
         AudioDeviceDescriptor::document(path);
         Audio::document(path);
@@ -4660,12 +6595,19 @@ namespace ConfigurationObjects
         Presence::document(path);
         Advertising::document(path);
         GroupTimeline::document(path);
+        RallypointSelection::document(path);
         Group::document(path);
         Mission::document(path);
         LicenseDescriptor::document(path);
+        NetworkIoBackend::document(path);
+        UdpBatching::document(path);
+        TxSchedulerQueue::document(path);
+        TxScheduler::document(path);
+        RallypointMultiplexing::document(path);
         EnginePolicyNetworking::document(path);
         EnginePolicyAudio::document(path);
         SecurityCertificate::document(path);
+        TlsSessionResumption::document(path);
         EnginePolicySecurity::document(path);
         EnginePolicyLogging::document(path);
         EnginePolicyLicensing::document(path);
@@ -4683,6 +6625,15 @@ namespace ConfigurationObjects
         RallypointPeer::document(path);
         RallypointServerStatusReport::document(path);
         RallypointExternalHealthCheckResponder::document(path);
+        RallypointMetricsEndpoint::document(path);
+        RallypointMeshRouting::document(path);
+        RallypointIoPoolSharding::document(path);
+        RallypointAdmissionControl::document(path);
+        RallypointTokenBucket::document(path);
+        RallypointTrafficControl::document(path);
+        RallypointDrain::document(path);
+        RallypointRegistrationSnapshot::document(path);
+        TlsKernelOffload::document(path);
         Tls::document(path);
         RallypointServer::document(path);
         PlatformDiscoveredService::document(path);
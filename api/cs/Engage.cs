@@ -258,6 +258,18 @@ public class Engage
             public class Security
             {
                 public static String objectName = "security";
+
+                public class TlsSessionResumption
+                {
+                    public static String objectName = "tlsSessionResumption";
+                    public static String enabled = "enabled";
+                    public static String useSessionTickets = "useSessionTickets";
+                    public static String sessionLifetimeSecs = "sessionLifetimeSecs";
+                    public static String maxCachedSessions = "maxCachedSessions";
+                    public static String ticketKeyRotationSecs = "ticketKeyRotationSecs";
+                    public static String allowEarlyData = "allowEarlyData";
+                    public static String cacheFileName = "cacheFileName";
+                }
             }
 
             public class Certificate
@@ -289,7 +301,59 @@ public class Engage
                 public static String rpLeafConnectTimeoutSecs = "rpLeafConnectTimeoutSecs";
                 public static String maxReconnectPauseMs = "maxReconnectPauseMs";
                 public static String reconnectFailurePauseIncrementMs = "reconnectFailurePauseIncrementMs";
+                public static String reconnectBackoff = "reconnectBackoff";
+                public static String minReconnectPauseMs = "minReconnectPauseMs";
                 public static String sendFailurePauseMs = "sendFailurePauseMs";
+                public static String shareMulticastSockets = "shareMulticastSockets";
+
+                public class UdpBatching
+                {
+                    public static String objectName = "udpBatching";
+                    public static String enabled = "enabled";
+                    public static String maxRxBatch = "maxRxBatch";
+                    public static String maxTxBatch = "maxTxBatch";
+                    public static String enableGso = "enableGso";
+                    public static String enableGro = "enableGro";
+                    public static String logStatsIntervalMs = "logStatsIntervalMs";
+                }
+
+                public class TxScheduler
+                {
+                    public static String objectName = "txScheduler";
+                    public static String enabled = "enabled";
+                    public static String logQueueDelayHistogramsIntervalMs = "logQueueDelayHistogramsIntervalMs";
+                    public static String queueDelayHistogramBucketsMs = "queueDelayHistogramBucketsMs";
+
+                    public class Queue
+                    {
+                        public static String arrayName = "queues";
+                        public static String priority = "priority";
+                        public static String maxPackets = "maxPackets";
+                        public static String strict = "strict";
+                        public static String quantumBytes = "quantumBytes";
+                    }
+                }
+
+                public class RallypointMultiplexing
+                {
+                    public static String objectName = "rallypointMultiplexing";
+                    public static String enabled = "enabled";
+                    public static String maxStreamsPerConnection = "maxStreamsPerConnection";
+                    public static String initialStreamCreditBytes = "initialStreamCreditBytes";
+                    public static String creditUpdateThresholdPercentage = "creditUpdateThresholdPercentage";
+                }
+
+                public class IoBackend
+                {
+                    public static String objectName = "ioBackend";
+                    public static String type = "type";
+                    public static String queueDepth = "queueDepth";
+                    public static String registeredBufferCount = "registeredBufferCount";
+                    public static String registeredBufferSize = "registeredBufferSize";
+                    public static String multishotReceive = "multishotReceive";
+                    public static String sqPoll = "sqPoll";
+                    public static String sqPollIdleMs = "sqPollIdleMs";
+                }
             }
 
             public class Discovery
@@ -348,6 +412,17 @@ public class Engage
             public static String allowSelfSignedCertificate = "allowSelfSignedCertificate";
             public static String transactionTimeoutMs = "transactionTimeoutMs";
             public static String disableMessageSigning = "disableMessageSigning";
+            public static String messageAuthentication = "messageAuthentication";
+
+            public class UdpMedia
+            {
+                public static String objectName = "udpMedia";
+                public static String enabled = "enabled";
+                public static String port = "port";
+                public static String keepaliveIntervalMs = "keepaliveIntervalMs";
+                public static String fallbackTimeoutMs = "fallbackTimeoutMs";
+                public static String replayWindowPackets = "replayWindowPackets";
+            }
         }
 
         public class Address
@@ -384,6 +459,16 @@ public class Engage
             public static String alias = "alias";
         }
 
+        public class RallypointSelection
+        {
+            public static String objectName = "rallypointSelection";
+            public static String policy = "policy";
+            public static String raceCount = "raceCount";
+            public static String migrationRttImprovementPercentage = "migrationRttImprovementPercentage";
+            public static String migrationMinRttImprovementMs = "migrationMinRttImprovementMs";
+            public static String migrationHoldDownSecs = "migrationHoldDownSecs";
+        }
+
         public class TxAudio
         {
             public static String objectName = "txAudio";
@@ -392,6 +477,31 @@ public class Engage
             public static String framingMs = "framingMs";
             public static String maxTxSecs = "maxTxSecs";
             public static String noHdrExt = "noHdrExt";
+
+            public class Vad
+            {
+                public static String objectName = "vad";
+                public static String enabled = "enabled";
+                public static String mode = "mode";
+                public static String thresholdDb = "thresholdDb";
+                public static String hangoverMs = "hangoverMs";
+                public static String thinIntervalMs = "thinIntervalMs";
+                public static String useCodecDtx = "useCodecDtx";
+                public static String comfortNoise = "comfortNoise";
+                public static String comfortNoiseIntervalMs = "comfortNoiseIntervalMs";
+            }
+
+            public class Packetization
+            {
+                public static String objectName = "packetization";
+                public static String enabled = "enabled";
+                public static String minFramesPerPacket = "minFramesPerPacket";
+                public static String maxFramesPerPacket = "maxFramesPerPacket";
+                public static String rttThresholdMs = "rttThresholdMs";
+                public static String lossThresholdPercentage = "lossThresholdPercentage";
+                public static String evaluationIntervalMs = "evaluationIntervalMs";
+                public static String minChangeIntervalMs = "minChangeIntervalMs";
+            }
         }
 
         public class Presence
@@ -0,0 +1,775 @@
+//
+//  Copyright (c) 2020 Rally Tactical Systems, Inc.
+//  All rights reserved.
+//
+//  PLEASE NOTE: This code is used internally at Rally Tactical Systems as a test harness
+//               for capacity-testing Rallypoints.  As such, it is NOT meant for production
+//               use NOR is it meant as a representation of best-practises on how to use the
+//               Engine.
+//
+//  engage-loadgen puts synthetic load on a Rallypoint running on the same machine.  It forks
+//  one process per simulated leaf; each runs its own Engine instance with its own Rallypoint
+//  connection (real Engage framing and TLS) and registers a number of groups.  Every leaf then
+//  talks on its groups in talk-spurts, sending timestamped RTP payloads at the framing interval,
+//  and times the arrival of everyone else's payloads.  At the end of the run the parent gathers
+//  the results and reports forwarded packets per second, delivery latency percentiles and - if
+//  given the Rallypoint's process id - the Rallypoint's CPU time per forwarded packet and its
+//  memory per connected client.
+//
+//  Linux only.  Build it the same way as engage-cmd (EngageMain.cpp), linking with the
+//  libengage-shared library.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <random>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+
+#include "EngageInterface.h"
+#include "ConfigurationObjects.h"
+
+// RTP payload type used for load traffic
+static const int LOADGEN_RTP_PT = 120;
+
+// Marks payloads as ours
+static const uint32_t LOADGEN_MAGIC = 0x4C4F4144;
+
+// Latency histogram - 100 microsecond buckets up to 2 seconds, with the last bucket catching anything longer
+static const int LATENCY_BUCKET_US = 100;
+static const int LATENCY_BUCKETS = 20000;
+
+typedef struct
+{
+    uint32_t    magic;
+    uint32_t    client;
+    uint64_t    sentNs;
+} LoadPayloadHeader_t;
+
+typedef struct
+{
+    uint64_t    groupsConnected;
+    uint64_t    sent;
+    uint64_t    received;
+    uint32_t    latency[LATENCY_BUCKETS];
+} ClientResult_t;
+
+typedef struct
+{
+    pid_t       pid;
+    int         readyFd;
+    int         goFd;
+    int         resultFd;
+    bool        alive;
+} Child_t;
+
+typedef struct
+{
+    std::string     id;
+    bool            talking;
+    uint64_t        nextChangeNs;
+    uint16_t        seq;
+    bool            marker;
+} GroupState_t;
+
+int g_clients = 10;
+int g_groupsPerClient = 10;
+int g_groupPool = 0;
+int g_secs = 60;
+int g_framingMs = 20;
+int g_payloadSize = 60;
+int g_spurtMs = 3000;
+int g_gapMs = 10000;
+int g_connectTimeoutSecs = 30;
+pid_t g_rpPid = 0;
+
+ConfigurationObjects::EnginePolicy g_enginePolicy;
+ConfigurationObjects::Rallypoint g_rallypoint;
+
+int g_myIndex = -1;
+std::atomic<uint64_t> g_groupsConnected(0);
+std::atomic<uint64_t> g_received(0);
+std::mutex g_latencyLock;
+ClientResult_t *g_result = nullptr;
+
+void showUsage();
+bool loadPolicy(const char *pszFn, ConfigurationObjects::EnginePolicy *pPolicy);
+bool loadRp(const char *pszFn, ConfigurationObjects::Rallypoint *pRp);
+int runClient(int index, int readyFd, int goFd, int resultFd);
+
+static uint64_t nowNs()
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static bool readFully(int fd, void *buff, size_t size)
+{
+    uint8_t *p = (uint8_t*)buff;
+
+    while(size > 0)
+    {
+        ssize_t rc = read(fd, p, size);
+        if(rc <= 0)
+        {
+            return false;
+        }
+
+        p += rc;
+        size -= (size_t)rc;
+    }
+
+    return true;
+}
+
+static bool writeFully(int fd, const void *buff, size_t size)
+{
+    const uint8_t *p = (const uint8_t*)buff;
+
+    while(size > 0)
+    {
+        ssize_t rc = write(fd, p, size);
+        if(rc <= 0)
+        {
+            return false;
+        }
+
+        p += rc;
+        size -= (size_t)rc;
+    }
+
+    return true;
+}
+
+// Process CPU time (user + system) in seconds and resident memory in KB, from /proc
+static bool sampleProcess(pid_t pid, double *cpuSecs, uint64_t *rssKb)
+{
+    char path[64];
+    char buff[2048];
+    FILE *fp;
+
+    snprintf(path, sizeof(path), "/proc/%d/stat", (int)pid);
+    fp = fopen(path, "r");
+    if(fp == nullptr)
+    {
+        return false;
+    }
+
+    size_t len = fread(buff, 1, sizeof(buff) - 1, fp);
+    fclose(fp);
+    buff[len] = 0;
+
+    // Fields after the command name, which is in parentheses and may contain spaces
+    const char *p = strrchr(buff, ')');
+    if(p == nullptr)
+    {
+        return false;
+    }
+
+    unsigned long utime = 0;
+    unsigned long stime = 0;
+    long rssPages = 0;
+
+    if(sscanf(p + 2, "%*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %lu %lu %*d %*d %*d %*d %*d %*d %*u %*u %ld",
+              &utime, &stime, &rssPages) != 3)
+    {
+        return false;
+    }
+
+    *cpuSecs = (double)(utime + stime) / (double)sysconf(_SC_CLK_TCK);
+    *rssKb = (uint64_t)rssPages * (uint64_t)sysconf(_SC_PAGESIZE) / 1024;
+
+    return true;
+}
+
+static uint32_t latencyPercentile(const std::vector<uint64_t>& histogram, uint64_t total, double percentile)
+{
+    uint64_t target = (uint64_t)((double)total * percentile / 100.0);
+    uint64_t running = 0;
+
+    for(int x = 0; x < LATENCY_BUCKETS; x++)
+    {
+        running += histogram[x];
+        if(running > target)
+        {
+            return (uint32_t)((x + 1) * LATENCY_BUCKET_US);
+        }
+    }
+
+    return (uint32_t)(LATENCY_BUCKETS * LATENCY_BUCKET_US);
+}
+
+int main(int argc, const char * argv[])
+{
+    const char *epFile = nullptr;
+    const char *rpFile = nullptr;
+
+    for(int x = 1; x < argc; x++)
+    {
+        if(strcmp(argv[x], "-?") == 0)
+        {
+            showUsage();
+            return 0;
+        }
+        else if(strncmp(argv[x], "-ep:", 4) == 0)
+        {
+            epFile = argv[x] + 4;
+        }
+        else if(strncmp(argv[x], "-rp:", 4) == 0)
+        {
+            rpFile = argv[x] + 4;
+        }
+        else if(strncmp(argv[x], "-clients:", 9) == 0)
+        {
+            g_clients = atoi(argv[x] + 9);
+        }
+        else if(strncmp(argv[x], "-groups:", 8) == 0)
+        {
+            g_groupsPerClient = atoi(argv[x] + 8);
+        }
+        else if(strncmp(argv[x], "-pool:", 6) == 0)
+        {
+            g_groupPool = atoi(argv[x] + 6);
+        }
+        else if(strncmp(argv[x], "-secs:", 6) == 0)
+        {
+            g_secs = atoi(argv[x] + 6);
+        }
+        else if(strncmp(argv[x], "-framing:", 9) == 0)
+        {
+            g_framingMs = atoi(argv[x] + 9);
+        }
+        else if(strncmp(argv[x], "-size:", 6) == 0)
+        {
+            g_payloadSize = atoi(argv[x] + 6);
+        }
+        else if(strncmp(argv[x], "-spurt:", 7) == 0)
+        {
+            g_spurtMs = atoi(argv[x] + 7);
+        }
+        else if(strncmp(argv[x], "-gap:", 5) == 0)
+        {
+            g_gapMs = atoi(argv[x] + 5);
+        }
+        else if(strncmp(argv[x], "-connecttimeout:", 16) == 0)
+        {
+            g_connectTimeoutSecs = atoi(argv[x] + 16);
+        }
+        else if(strncmp(argv[x], "-rppid:", 7) == 0)
+        {
+            g_rpPid = (pid_t)atoi(argv[x] + 7);
+        }
+        else
+        {
+            std::cout << "unknown option '" << argv[x] << "'" << std::endl;
+            showUsage();
+            return 1;
+        }
+    }
+
+    if(g_groupPool <= 0)
+    {
+        g_groupPool = g_groupsPerClient;
+    }
+
+    if(g_clients <= 0 || g_groupsPerClient <= 0 || g_groupPool < g_groupsPerClient || g_secs <= 0 || g_framingMs <= 0 ||
+       g_payloadSize < (int)sizeof(LoadPayloadHeader_t) || g_payloadSize > 512 || g_spurtMs <= 0 || g_gapMs < 0)
+    {
+        showUsage();
+        return 1;
+    }
+
+    if(epFile != nullptr && !loadPolicy(epFile, &g_enginePolicy))
+    {
+        std::cerr << "could not load engine policy '" << epFile << "'" << std::endl;
+        return 1;
+    }
+
+    if(rpFile != nullptr)
+    {
+        if(!loadRp(rpFile, &g_rallypoint))
+        {
+            std::cerr << "could not load rallypoint '" << rpFile << "'" << std::endl;
+            return 1;
+        }
+    }
+    else
+    {
+        g_rallypoint.host.address = "127.0.0.1";
+        g_rallypoint.host.port = 7443;
+        g_rallypoint.certificate = "@./rtsFactoryDefaultEngage.pem";
+        g_rallypoint.certificateKey = "@./rtsFactoryDefaultEngage.key";
+    }
+
+    std::cout << "engage-loadgen: clients=" << g_clients
+              << ", groups=" << g_groupsPerClient
+              << ", pool=" << g_groupPool
+              << ", secs=" << g_secs
+              << ", framingMs=" << g_framingMs
+              << ", size=" << g_payloadSize
+              << ", spurtMs=" << g_spurtMs
+              << ", gapMs=" << g_gapMs
+              << ", rallypoint=" << g_rallypoint.host.address << ":" << g_rallypoint.host.port << std::endl;
+
+    double rpCpuIdle = 0.0;
+    uint64_t rpRssIdle = 0;
+    if(g_rpPid > 0 && !sampleProcess(g_rpPid, &rpCpuIdle, &rpRssIdle))
+    {
+        std::cerr << "cannot read /proc for rallypoint process " << g_rpPid << std::endl;
+        return 1;
+    }
+
+    // A leaf that gives up early closes its end of the pipes - that must show up as a failed write, not kill us
+    signal(SIGPIPE, SIG_IGN);
+
+    // One process per simulated leaf - each with its own Engine and its own Rallypoint connection
+    std::vector<Child_t> children;
+    for(int x = 0; x < g_clients; x++)
+    {
+        int readyPipe[2];
+        int goPipe[2];
+        int resultPipe[2];
+
+        if(pipe(readyPipe) != 0 || pipe(goPipe) != 0 || pipe(resultPipe) != 0)
+        {
+            std::cerr << "pipe failed" << std::endl;
+            return 1;
+        }
+
+        pid_t pid = fork();
+        if(pid < 0)
+        {
+            std::cerr << "fork failed after " << x << " clients" << std::endl;
+            return 1;
+        }
+
+        if(pid == 0)
+        {
+            for(Child_t& c : children)
+            {
+                close(c.readyFd);
+                close(c.goFd);
+                close(c.resultFd);
+            }
+
+            close(readyPipe[0]);
+            close(goPipe[1]);
+            close(resultPipe[0]);
+
+            _exit(runClient(x, readyPipe[1], goPipe[0], resultPipe[1]));
+        }
+
+        close(readyPipe[1]);
+        close(goPipe[0]);
+        close(resultPipe[1]);
+
+        Child_t c;
+        c.pid = pid;
+        c.readyFd = readyPipe[0];
+        c.goFd = goPipe[1];
+        c.resultFd = resultPipe[0];
+        c.alive = true;
+        children.push_back(c);
+    }
+
+    // Wait for every leaf to connect and register before load starts.  Leaves with nothing connected are left out of the run.
+    uint64_t groupsConnected = 0;
+    int dead = 0;
+    for(size_t x = 0; x < children.size(); x++)
+    {
+        Child_t& c = children[x];
+        uint64_t connected = 0;
+
+        if(readFully(c.readyFd, &connected, sizeof(connected)) && connected > 0)
+        {
+            groupsConnected += connected;
+        }
+        else
+        {
+            std::cerr << "client " << x << ": no groups connected, left out of the run" << std::endl;
+            c.alive = false;
+            dead++;
+        }
+    }
+
+    std::cout << "all clients ready, " << groupsConnected << " of " << ((uint64_t)g_clients * (uint64_t)g_groupsPerClient) << " group registrations connected" << std::endl;
+
+    double rpCpuStart = 0.0;
+    uint64_t rpRssLoaded = 0;
+    if(g_rpPid > 0)
+    {
+        sampleProcess(g_rpPid, &rpCpuStart, &rpRssLoaded);
+    }
+
+    uint64_t startNs = nowNs();
+    for(size_t x = 0; x < children.size(); x++)
+    {
+        Child_t& c = children[x];
+
+        if(c.alive && !writeFully(c.goFd, &startNs, sizeof(startNs)))
+        {
+            std::cerr << "client " << x << ": could not be started, left out of the run" << std::endl;
+            c.alive = false;
+            dead++;
+        }
+
+        // Closing a dead leaf's go pipe lets it stop waiting and exit
+        if(!c.alive)
+        {
+            close(c.goFd);
+            c.goFd = -1;
+        }
+    }
+
+    // Gather results as each leaf finishes
+    ClientResult_t *result = new ClientResult_t();
+    std::vector<uint64_t> latency(LATENCY_BUCKETS, 0);
+    uint64_t sent = 0;
+    uint64_t received = 0;
+    int reported = 0;
+
+    for(Child_t& c : children)
+    {
+        if(c.alive && readFully(c.resultFd, result, sizeof(*result)))
+        {
+            sent += result->sent;
+            received += result->received;
+            for(int x = 0; x < LATENCY_BUCKETS; x++)
+            {
+                latency[x] += result->latency[x];
+            }
+            reported++;
+        }
+
+        close(c.readyFd);
+        if(c.goFd >= 0)
+        {
+            close(c.goFd);
+        }
+        close(c.resultFd);
+        waitpid(c.pid, nullptr, 0);
+    }
+
+    delete result;
+
+    double rpCpuEnd = 0.0;
+    uint64_t rpRssEnd = 0;
+    if(g_rpPid > 0)
+    {
+        sampleProcess(g_rpPid, &rpCpuEnd, &rpRssEnd);
+    }
+
+    printf("clients reporting .... %d of %d (%d left out)\n", reported, g_clients, dead);
+    printf("packets sent ......... %" PRIu64 "\n", sent);
+    printf("packets received ..... %" PRIu64 " (%.2f per packet sent)\n", received, sent ? (double)received / (double)sent : 0.0);
+    printf("forwarded pps ........ %.0f\n", (double)received / (double)g_secs);
+    if(received > 0)
+    {
+        printf("latency .............. p50 %u us, p99 %u us, p99.9 %u us, p99.99 %u us (+/- %d us)\n",
+                latencyPercentile(latency, received, 50.0),
+                latencyPercentile(latency, received, 99.0),
+                latencyPercentile(latency, received, 99.9),
+                latencyPercentile(latency, received, 99.99),
+                LATENCY_BUCKET_US);
+    }
+
+    if(g_rpPid > 0)
+    {
+        printf("rallypoint cpu ....... %.2f secs (%.2f us per forwarded packet)\n",
+                rpCpuEnd - rpCpuStart,
+                received ? ((rpCpuEnd - rpCpuStart) * 1000000.0) / (double)received : 0.0);
+        printf("rallypoint memory .... %" PRIu64 " KB idle, %" PRIu64 " KB loaded (%.1f KB per client)\n",
+                rpRssIdle, rpRssLoaded,
+                (rpRssLoaded > rpRssIdle && g_clients > dead) ? (double)(rpRssLoaded - rpRssIdle) / (double)(g_clients - dead) : 0.0);
+        printf("rallypoint growth .... %" PRIu64 " KB at end (%+" PRId64 " KB while the load ran)\n",
+                rpRssEnd, (int64_t)rpRssEnd - (int64_t)rpRssLoaded);
+    }
+
+    return 0;
+}
+
+// ---------------------------------------------------------------------------------------------
+// Leaf (child process)
+// ---------------------------------------------------------------------------------------------
+void on_ENGAGE_GROUP_CONNECTED(const char *pId)
+{
+    (void)pId;
+
+    g_groupsConnected++;
+}
+
+void on_ENGAGE_GROUP_DISCONNECTED(const char *pId)
+{
+    (void)pId;
+
+    if(g_groupsConnected > 0)
+    {
+        g_groupsConnected--;
+    }
+}
+
+void on_ENGAGE_GROUP_RTP_RECEIVED(const char *pId, const char *pszRtpHeaderJson, const uint8_t *payload, size_t payloadSize)
+{
+    (void)pId;
+    (void)pszRtpHeaderJson;
+
+    LoadPayloadHeader_t hdr;
+
+    if(payloadSize < sizeof(hdr))
+    {
+        return;
+    }
+
+    memcpy(&hdr, payload, sizeof(hdr));
+    if(hdr.magic != LOADGEN_MAGIC || hdr.client == (uint32_t)g_myIndex)
+    {
+        return;
+    }
+
+    uint64_t now = nowNs();
+    uint64_t us = (now > hdr.sentNs) ? (now - hdr.sentNs) / 1000 : 0;
+    uint64_t bucket = std::min<uint64_t>(us / LATENCY_BUCKET_US, LATENCY_BUCKETS - 1);
+
+    g_received++;
+
+    std::lock_guard<std::mutex> lock(g_latencyLock);
+    g_result->latency[bucket]++;
+}
+
+bool registerLoadGenCallbacks()
+{
+    EngageEvents_t cb;
+
+    memset(&cb, 0, sizeof(cb));
+
+    cb.PFN_ENGAGE_GROUP_CONNECTED = on_ENGAGE_GROUP_CONNECTED;
+    cb.PFN_ENGAGE_GROUP_DISCONNECTED = on_ENGAGE_GROUP_DISCONNECTED;
+    cb.PFN_ENGAGE_GROUP_RTP_RECEIVED = on_ENGAGE_GROUP_RTP_RECEIVED;
+
+    return (engageRegisterEventCallbacks(&cb) == ENGAGE_RESULT_OK);
+}
+
+int runClient(int index, int readyFd, int goFd, int resultFd)
+{
+    std::mt19937_64 rng((uint64_t)index * 7919 + 17);
+    std::exponential_distribution<double> spurtLength(1.0 / (double)g_spurtMs);
+    std::exponential_distribution<double> gapLength(1.0 / (double)std::max(1, g_gapMs));
+    std::vector<GroupState_t> groups;
+    std::vector<uint8_t> payload(g_payloadSize, 0);
+    uint64_t connected = 0;
+    uint64_t startNs = 0;
+    std::string identityJson;
+
+    g_myIndex = index;
+    g_result = new ClientResult_t();
+    memset(g_result, 0, sizeof(*g_result));
+
+    if(!registerLoadGenCallbacks())
+    {
+        std::cerr << "client " << index << ": callback registration failed" << std::endl;
+        writeFully(readyFd, &connected, sizeof(connected));
+        return 1;
+    }
+
+    identityJson = "{\"userId\":\"loadgen-";
+    identityJson += std::to_string(index);
+    identityJson += "@engagedev.rallytac.com\",\"displayName\":\"Load ";
+    identityJson += std::to_string(index);
+    identityJson += "\"}";
+
+    if(engageInitialize(g_enginePolicy.serialize().c_str(), identityJson.c_str(), nullptr) != ENGAGE_RESULT_OK ||
+       engageStart() != ENGAGE_RESULT_OK)
+    {
+        std::cerr << "client " << index << ": engine start failed" << std::endl;
+        writeFully(readyFd, &connected, sizeof(connected));
+        return 1;
+    }
+
+    // Spread each leaf's groups across the pool so that leaves overlap on some groups but not all
+    for(int x = 0; x < g_groupsPerClient; x++)
+    {
+        int poolIndex = (index + (x * std::max(1, g_groupPool / g_groupsPerClient))) % g_groupPool;
+        char id[64];
+
+        snprintf(id, sizeof(id), "{loadgen-%06d}", poolIndex);
+
+        ConfigurationObjects::Group groupConfig;
+        groupConfig.type = ConfigurationObjects::Group::gtAudio;
+        groupConfig.id = id;
+        groupConfig.name = id;
+        groupConfig.rallypoints.push_back(g_rallypoint);
+
+        GroupState_t gs;
+        gs.id = id;
+        gs.talking = false;
+        gs.nextChangeNs = 0;
+        gs.seq = 0;
+        gs.marker = false;
+        groups.push_back(gs);
+
+        engageCreateGroup(groupConfig.serialize().c_str());
+        engageRegisterGroupRtpHandler(id, LOADGEN_RTP_PT);
+        engageJoinGroup(id);
+    }
+
+    // Wait for our registrations to connect (or give up)
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(g_connectTimeoutSecs);
+    while(g_groupsConnected < (uint64_t)g_groupsPerClient && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    connected = g_groupsConnected;
+    writeFully(readyFd, &connected, sizeof(connected));
+
+    if(!readFully(goFd, &startNs, sizeof(startNs)))
+    {
+        engageStop();
+        engageShutdown();
+        return 1;
+    }
+
+    // Start every group idle for a random part of a gap so that spurts don't line up across leaves
+    for(GroupState_t& gs : groups)
+    {
+        gs.nextChangeNs = startNs + (uint64_t)(gapLength(rng) * 1000000.0);
+    }
+
+    uint64_t endNs = startNs + ((uint64_t)g_secs * 1000000000ULL);
+    auto next = std::chrono::steady_clock::now();
+    LoadPayloadHeader_t hdr;
+
+    hdr.magic = LOADGEN_MAGIC;
+    hdr.client = (uint32_t)index;
+
+    while(nowNs() < endNs)
+    {
+        uint64_t now = nowNs();
+
+        for(GroupState_t& gs : groups)
+        {
+            if(now >= gs.nextChangeNs)
+            {
+                gs.talking = !gs.talking;
+                gs.marker = gs.talking;
+                gs.nextChangeNs = now + (uint64_t)((gs.talking ? spurtLength(rng) : gapLength(rng)) * 1000000.0);
+            }
+
+            if(!gs.talking)
+            {
+                continue;
+            }
+
+            ConfigurationObjects::RtpHeader rtpHeader;
+            rtpHeader.pt = LOADGEN_RTP_PT;
+            rtpHeader.marker = gs.marker;
+            rtpHeader.seq = gs.seq++;
+            rtpHeader.ssrc = (uint32_t)index;
+            rtpHeader.ts = (uint32_t)(rtpHeader.seq * 8 * g_framingMs);
+            gs.marker = false;
+
+            hdr.sentNs = nowNs();
+            memcpy(payload.data(), &hdr, sizeof(hdr));
+
+            if(engageSendGroupRtp(gs.id.c_str(), payload.data(), payload.size(), rtpHeader.serialize().c_str()) == ENGAGE_RESULT_OK)
+            {
+                g_result->sent++;
+            }
+        }
+
+        next += std::chrono::milliseconds(g_framingMs);
+        std::this_thread::sleep_until(next);
+    }
+
+    // Let packets in flight arrive before tallying up
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    for(GroupState_t& gs : groups)
+    {
+        engageLeaveGroup(gs.id.c_str());
+        engageDeleteGroup(gs.id.c_str());
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(g_latencyLock);
+        g_result->groupsConnected = connected;
+        g_result->received = g_received;
+        writeFully(resultFd, g_result, sizeof(*g_result));
+    }
+
+    engageStop();
+    engageShutdown();
+
+    return 0;
+}
+
+// ---------------------------------------------------------------------------------------------
+void showUsage()
+{
+    std::cout << "usage: engage-loadgen [options]" << std::endl << std::endl
+              << "\twhere [options] are:" << std::endl << std::endl
+              << "\t-rp:<rallypoint_file> ................. rallypoint to connect to (default 127.0.0.1:7443 with factory certificates)" << std::endl
+              << "\t-ep:<engine_policy_file> .............. engine policy for each client" << std::endl
+              << "\t-clients:<count> ...................... number of simulated leaf connections (default 10)" << std::endl
+              << "\t-groups:<count> ....................... groups registered by each client (default 10)" << std::endl
+              << "\t-pool:<count> ......................... distinct groups shared among the clients (default same as -groups)" << std::endl
+              << "\t-secs:<seconds> ....................... duration of the load (default 60)" << std::endl
+              << "\t-framing:<ms> ......................... packet interval while talking (default 20)" << std::endl
+              << "\t-size:<bytes> ......................... payload size, 16 to 512 (default 60)" << std::endl
+              << "\t-spurt:<ms> ........................... mean talk-spurt length (default 3000)" << std::endl
+              << "\t-gap:<ms> ............................. mean gap between talk-spurts (default 10000)" << std::endl
+              << "\t-connecttimeout:<seconds> ............. time allowed for clients to connect (default 30)" << std::endl
+              << "\t-rppid:<pid> .......................... process id of the local rallypointd to measure" << std::endl
+              << "\t-? .................................... show this help" << std::endl;
+}
+
+bool loadPolicy(const char *pszFn, ConfigurationObjects::EnginePolicy *pPolicy)
+{
+    bool rc = false;
+
+    try
+    {
+        std::string jsonText;
+        ConfigurationObjects::readTextFileIntoString(pszFn, jsonText);
+
+        nlohmann::json j = nlohmann::json::parse(jsonText);
+        ConfigurationObjects::from_json(j, *pPolicy);
+        rc = true;
+    }
+    catch (...)
+    {
+    }
+
+    return rc;
+}
+
+bool loadRp(const char *pszFn, ConfigurationObjects::Rallypoint *pRp)
+{
+    bool rc = false;
+
+    try
+    {
+        std::string jsonText;
+        ConfigurationObjects::readTextFileIntoString(pszFn, jsonText);
+
+        nlohmann::json j = nlohmann::json::parse(jsonText);
+        ConfigurationObjects::from_json(j, *pRp);
+        rc = true;
+    }
+    catch (...)
+    {
+    }
+
+    return rc;
+}
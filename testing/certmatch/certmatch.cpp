@@ -0,0 +1,474 @@
+//
+//  Copyright (c) 2020 Rally Tactical Systems, Inc.
+//  All rights reserved.
+//
+//  Certificate subject/issuer matcher benchmark
+//
+//  Checks certificate subjects and issuers against allow and deny lists the way a Rallypoint does
+//  for every TLS handshake it accepts (see whitelistedSubjects, whitelistedIssuers,
+//  blacklistedSubjects and blacklistedIssuers in Tls).  A list entry is either an exact name or,
+//  if it ends in '*', a prefix.  The lists are checked in one of two ways:
+//
+//      linear   - every entry of every list is compared in turn.
+//
+//      compiled - when the lists are loaded, exact entries are put in hash sets and prefix entries
+//                 in a trie.  A check is one hash lookup plus one walk down the trie no deeper
+//                 than the name being checked.  The compiled matcher is immutable; a reload builds
+//                 a new one and swaps it in atomically while handshakes carry on with the old one.
+//
+//  Build with:
+//
+//      g++ -std=c++11 -O2 -pthread -I../common certmatch.cpp -o certmatch
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_set>
+#include <memory>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
+#include "benchcommon.h"
+
+typedef struct
+{
+    std::vector<std::string>    whitelistedSubjects;
+    std::vector<std::string>    whitelistedIssuers;
+    std::vector<std::string>    blacklistedSubjects;
+    std::vector<std::string>    blacklistedIssuers;
+} Lists_t;
+
+// Prefix entries, one node per character
+class PrefixTrie
+{
+public:
+    void add(const std::string& prefix)
+    {
+        Node *n = &_root;
+
+        for(char c : prefix)
+        {
+            std::unique_ptr<Node>& child = n->children[c];
+            if(!child)
+            {
+                child.reset(new Node());
+            }
+            n = child.get();
+        }
+
+        n->terminal = true;
+    }
+
+    bool matches(const std::string& name) const
+    {
+        const Node *n = &_root;
+
+        if(n->terminal)
+        {
+            return true;
+        }
+
+        for(char c : name)
+        {
+            auto itr = n->children.find(c);
+            if(itr == n->children.end())
+            {
+                return false;
+            }
+
+            n = itr->second.get();
+            if(n->terminal)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+private:
+    struct Node
+    {
+        Node() : terminal(false) {}
+
+        bool                                terminal;
+        std::map<char, std::unique_ptr<Node>> children;
+    };
+
+    Node    _root;
+};
+
+class CompiledList
+{
+public:
+    explicit CompiledList(const std::vector<std::string>& entries)
+    {
+        _empty = entries.empty();
+
+        for(const std::string& e : entries)
+        {
+            if(!e.empty() && e.back() == '*')
+            {
+                _prefixes.add(e.substr(0, e.size() - 1));
+            }
+            else
+            {
+                _exact.insert(e);
+            }
+        }
+    }
+
+    bool empty() const
+    {
+        return _empty;
+    }
+
+    bool matches(const std::string& name) const
+    {
+        return (_exact.find(name) != _exact.end()) || _prefixes.matches(name);
+    }
+
+private:
+    bool                            _empty;
+    std::unordered_set<std::string> _exact;
+    PrefixTrie                      _prefixes;
+};
+
+class CompiledMatcher
+{
+public:
+    CompiledMatcher(const Lists_t& lists, uint64_t generation)
+        : _generation(generation),
+          _whitelistedSubjects(lists.whitelistedSubjects),
+          _whitelistedIssuers(lists.whitelistedIssuers),
+          _blacklistedSubjects(lists.blacklistedSubjects),
+          _blacklistedIssuers(lists.blacklistedIssuers)
+    {
+    }
+
+    uint64_t generation() const
+    {
+        return _generation;
+    }
+
+    bool accept(const std::string& subject, const std::string& issuer) const
+    {
+        if(_blacklistedSubjects.matches(subject) || _blacklistedIssuers.matches(issuer))
+        {
+            return false;
+        }
+
+        if(!_whitelistedSubjects.empty() && !_whitelistedSubjects.matches(subject))
+        {
+            return false;
+        }
+
+        if(!_whitelistedIssuers.empty() && !_whitelistedIssuers.matches(issuer))
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+private:
+    uint64_t        _generation;
+    CompiledList    _whitelistedSubjects;
+    CompiledList    _whitelistedIssuers;
+    CompiledList    _blacklistedSubjects;
+    CompiledList    _blacklistedIssuers;
+};
+
+typedef enum
+{
+    modeLinear = 0,
+    modeCompiled = 1,
+    modeBoth = 2
+} Mode_t;
+
+static int                  g_prefixPercentage = 20;
+static int                  g_checks = 0;               // 0 = checksFor()
+static int                  g_reloadMs = 1;
+static int                  g_minReloads = 20;
+static int                  g_mode = modeBoth;
+
+// Unless -checks is given, lists longer than 1000 entries get proportionally fewer checks so that linear runs finish in seconds
+static int checksFor(int entries)
+{
+    if(g_checks > 0)
+    {
+        return g_checks;
+    }
+
+    return (entries > 1000 ? std::max(1000, 100000000 / entries) : 100000);
+}
+
+static bool linearMatches(const std::vector<std::string>& entries, const std::string& name)
+{
+    for(const std::string& e : entries)
+    {
+        if(!e.empty() && e.back() == '*')
+        {
+            if(name.compare(0, e.size() - 1, e, 0, e.size() - 1) == 0)
+            {
+                return true;
+            }
+        }
+        else if(e == name)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool linearAccept(const Lists_t& lists, const std::string& subject, const std::string& issuer)
+{
+    if(linearMatches(lists.blacklistedSubjects, subject) || linearMatches(lists.blacklistedIssuers, issuer))
+    {
+        return false;
+    }
+
+    if(!lists.whitelistedSubjects.empty() && !linearMatches(lists.whitelistedSubjects, subject))
+    {
+        return false;
+    }
+
+    if(!lists.whitelistedIssuers.empty() && !linearMatches(lists.whitelistedIssuers, issuer))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+static std::string makeName(const char *kind, int index)
+{
+    char tmp[128];
+    snprintf(tmp, sizeof(tmp), "/C=US/O=Rally Tactical Systems/OU=%s/CN=%s-%06d.rallytac.com", kind, kind, index);
+    return tmp;
+}
+
+static void buildLists(int entries, Lists_t *lists)
+{
+    int prefixes = (entries * g_prefixPercentage) / 100;
+
+    for(int x = 0; x < entries; x++)
+    {
+        bool prefix = (x < prefixes);
+
+        // Prefix entries cover a block of 10 names each, well away from the exact entries
+        std::string ws = prefix ? makeName("allowed", 1000000 + (x * 10)) : makeName("allowed", x);
+        std::string wi = prefix ? makeName("ca", 1000000 + (x * 10)) : makeName("ca", x);
+        std::string bs = prefix ? makeName("revoked", 1000000 + (x * 10)) : makeName("revoked", x);
+        std::string bi = prefix ? makeName("badca", 1000000 + (x * 10)) : makeName("badca", x);
+
+        if(prefix)
+        {
+            ws = ws.substr(0, ws.size() - 14) + "*";
+            wi = wi.substr(0, wi.size() - 14) + "*";
+            bs = bs.substr(0, bs.size() - 14) + "*";
+            bi = bi.substr(0, bi.size() - 14) + "*";
+        }
+
+        lists->whitelistedSubjects.push_back(ws);
+        lists->whitelistedIssuers.push_back(wi);
+        lists->blacklistedSubjects.push_back(bs);
+        lists->blacklistedIssuers.push_back(bi);
+    }
+}
+
+static void buildHandshakes(int entries, std::vector<std::pair<std::string, std::string>> *handshakes)
+{
+    uint64_t seed = 0x9e3779b97f4a7c15ULL;
+
+    // A spread of allowed, denied and unknown subjects, with known issuers
+    for(int x = 0; x < 4096; x++)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        int pick = (int)(seed % (uint64_t)entries);
+        std::string subject;
+
+        switch(x % 4)
+        {
+            case 0: subject = makeName("allowed", pick); break;
+            case 1: subject = makeName("revoked", pick); break;
+            case 2: subject = makeName("allowed", 1000000 + pick); break;
+            default: subject = makeName("stranger", pick); break;
+        }
+
+        handshakes->push_back(std::make_pair(subject, makeName("ca", pick)));
+    }
+}
+
+static void runLinear(int entries)
+{
+    int checks = checksFor(entries);
+    Lists_t lists;
+    std::vector<std::pair<std::string, std::string>> handshakes;
+    uint64_t accepted = 0;
+
+    buildLists(entries, &lists);
+    buildHandshakes(entries, &handshakes);
+
+    auto start = std::chrono::steady_clock::now();
+
+    for(int x = 0; x < checks; x++)
+    {
+        const std::pair<std::string, std::string>& h = handshakes[x % handshakes.size()];
+        if(linearAccept(lists, h.first, h.second))
+        {
+            accepted++;
+        }
+    }
+
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("linear    entries %-6d  %9.1f ns/check  accepted %" PRIu64 "/%d\n",
+            entries, (secs * 1000000000.0) / (double)checks, accepted, checks);
+}
+
+// Checks go on past the requested count, if need be, until at least g_minReloads reloads have happened during the run
+static void runCompiled(int entries)
+{
+    int checks = checksFor(entries);
+    Lists_t lists;
+    std::vector<std::pair<std::string, std::string>> handshakes;
+    uint64_t accepted = 0;
+    uint64_t made = 0;
+    uint64_t finishedOnReplaced = 0;
+    std::atomic<bool> running(true);
+    std::atomic<uint64_t> generation(1);
+    std::atomic<uint64_t> reloads(0);
+    bool reloading = (g_reloadMs > 0 && g_minReloads > 0);
+
+    buildLists(entries, &lists);
+    buildHandshakes(entries, &handshakes);
+
+    auto compileStart = std::chrono::steady_clock::now();
+    std::shared_ptr<const CompiledMatcher> matcher = std::make_shared<const CompiledMatcher>(lists, generation.load());
+    double compileSecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - compileStart).count();
+
+    // Reloads build a fresh matcher and swap it in while checks continue against whichever one they picked up
+    std::thread reloader;
+    if(reloading)
+    {
+        reloader = std::thread([&]()
+        {
+            while(running)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(g_reloadMs));
+
+                uint64_t next = generation.load() + 1;
+                std::shared_ptr<const CompiledMatcher> fresh = std::make_shared<const CompiledMatcher>(lists, next);
+
+                std::atomic_store(&matcher, fresh);
+                generation.store(next, std::memory_order_release);
+                reloads++;
+            }
+        });
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    while(made < (uint64_t)checks || (reloading && reloads.load() < (uint64_t)g_minReloads))
+    {
+        const std::pair<std::string, std::string>& h = handshakes[made % handshakes.size()];
+        std::shared_ptr<const CompiledMatcher> current = std::atomic_load(&matcher);
+        bool ok = current->accept(h.first, h.second);
+
+        // Only the first 'checks' results count, so that the accepted figure compares with the linear run
+        if(ok && made < (uint64_t)checks)
+        {
+            accepted++;
+        }
+
+        // The matcher this check used was swapped out while the check was in flight
+        if(current->generation() != generation.load(std::memory_order_acquire))
+        {
+            finishedOnReplaced++;
+        }
+
+        made++;
+    }
+
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    running = false;
+    if(reloader.joinable())
+    {
+        reloader.join();
+    }
+
+    printf("compiled  entries %-6d  %9.1f ns/check  accepted %" PRIu64 "/%d  (compile %.2f ms, %" PRIu64 " reloads during %" PRIu64 " checks, %" PRIu64 " finished on a replaced matcher)\n",
+            entries, (secs * 1000000000.0) / (double)made, accepted, checks, compileSecs * 1000.0, reloads.load(), made, finishedOnReplaced);
+}
+
+int main(int argc, const char *argv[])
+{
+    int entries = 0;
+    BenchCommon::Options options("certmatch");
+
+    options.addChoice("mode", {"linear", "compiled", "both"}, &g_mode, "matching method");
+    options.addInt("entries", "<count>", &entries, "entries in each list", "runs 10, 100, 1000 and 10000");
+    options.addInt("prefixes", "<percent>", &g_prefixPercentage, "percentage of entries that are prefixes");
+    options.addInt("checks", "<count>", &g_checks, "subject/issuer pairs to check per run", "100000, fewer above 1000 entries");
+    options.addInt("reload", "<ms>", &g_reloadMs, "pause between compiled matcher reloads, 0 for none");
+    options.addInt("minreloads", "<count>", &g_minReloads, "reloads each compiled run must see, 0 for none");
+
+    if(!options.parse(argc, argv))
+    {
+        return 1;
+    }
+
+    if(entries < 0 || g_checks < 0 || g_reloadMs < 0 || g_minReloads < 0 || g_prefixPercentage < 0 || g_prefixPercentage > 100)
+    {
+        options.showUsage();
+        return 1;
+    }
+
+    std::vector<int> sweep;
+    if(entries > 0)
+    {
+        sweep.push_back(entries);
+    }
+    else
+    {
+        sweep.push_back(10);
+        sweep.push_back(100);
+        sweep.push_back(1000);
+        sweep.push_back(10000);
+    }
+
+    std::cout << "certmatch: prefixes=" << g_prefixPercentage << "%"
+              << ", reloadMs=" << g_reloadMs
+              << ", minReloads=" << g_minReloads << std::endl;
+
+    for(int n : sweep)
+    {
+        if(g_mode != modeCompiled)
+        {
+            runLinear(n);
+        }
+
+        if(g_mode != modeLinear)
+        {
+            runCompiled(n);
+        }
+    }
+
+    return 0;
+}
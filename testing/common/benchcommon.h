@@ -0,0 +1,200 @@
+//
+//  Copyright (c) 2020 Rally Tactical Systems, Inc.
+//  All rights reserved.
+//
+//  Helpers shared by the benchmarks under testing/ - command-line options of the form
+//  -name:<value>, the usage text generated from them, and process CPU time.
+//
+//  Header-only; add -I../common when building a benchmark that uses it.
+//
+
+#ifndef BENCHCOMMON_H
+#define BENCHCOMMON_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/resource.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace BenchCommon
+{
+    // User plus system CPU time consumed by the process so far
+    static inline double cpuSecs()
+    {
+        struct rusage ru;
+
+        getrusage(RUSAGE_SELF, &ru);
+
+        return (double)(ru.ru_utime.tv_sec + ru.ru_stime.tv_sec) + ((double)(ru.ru_utime.tv_usec + ru.ru_stime.tv_usec) / 1000000.0);
+    }
+
+    class Options
+    {
+    public:
+        explicit Options(const char *tool)
+            : _tool(tool)
+        {
+        }
+
+        // An integer option.  The current value of *value is its default unless defaultText says otherwise.
+        void addInt(const char *name, const char *valueName, int *value, const char *description, const char *defaultText = nullptr)
+        {
+            Option_t o;
+
+            o.name = name;
+            o.valueName = valueName;
+            o.description = description;
+            o.defaultText = (defaultText != nullptr ? defaultText : std::to_string(*value));
+            o.intValue = value;
+            _options.push_back(o);
+        }
+
+        void addString(const char *name, const char *valueName, std::string *value, const char *description)
+        {
+            Option_t o;
+
+            o.name = name;
+            o.valueName = valueName;
+            o.description = description;
+            o.defaultText = *value;
+            o.stringValue = value;
+            _options.push_back(o);
+        }
+
+        // An option whose value must be one of choices.  *value receives the index of the choice.
+        void addChoice(const char *name, const std::vector<std::string>& choices, int *value, const char *description)
+        {
+            Option_t o;
+
+            o.name = name;
+            o.description = description;
+            o.choices = choices;
+            o.defaultText = choices[*value];
+            o.choiceValue = value;
+
+            for(size_t x = 0; x < choices.size(); x++)
+            {
+                o.valueName += (x == 0 ? "<" : "|");
+                o.valueName += choices[x];
+            }
+            o.valueName += ">";
+
+            _options.push_back(o);
+        }
+
+        // Returns false, having shown the usage text, if any argument is unknown or malformed
+        bool parse(int argc, const char *argv[])
+        {
+            for(int x = 1; x < argc; x++)
+            {
+                if(!parseOne(argv[x]))
+                {
+                    showUsage();
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        void showUsage() const
+        {
+            std::cout << "usage: " << _tool << " [options]" << std::endl << std::endl
+                      << "\twhere [options] are:" << std::endl << std::endl;
+
+            for(const Option_t& o : _options)
+            {
+                std::string left = std::string("-") + o.name + ":" + o.valueName + " ";
+
+                while(left.size() < 30)
+                {
+                    left += ".";
+                }
+
+                std::cout << "\t" << left << " " << o.description << " (default " << o.defaultText << ")" << std::endl;
+            }
+        }
+
+    private:
+        typedef struct Option_t
+        {
+            Option_t() : intValue(nullptr), stringValue(nullptr), choiceValue(nullptr) {}
+
+            std::string                 name;
+            std::string                 valueName;
+            std::string                 description;
+            std::string                 defaultText;
+            std::vector<std::string>    choices;
+            int                         *intValue;
+            std::string                 *stringValue;
+            int                         *choiceValue;
+        } Option_t;
+
+        bool parseOne(const char *arg)
+        {
+            for(const Option_t& o : _options)
+            {
+                size_t len = o.name.size();
+
+                if(arg[0] != '-' || strncmp(arg + 1, o.name.c_str(), len) != 0 || arg[len + 1] != ':')
+                {
+                    continue;
+                }
+
+                const char *value = arg + len + 2;
+
+                if(o.intValue != nullptr)
+                {
+                    char *end = nullptr;
+                    long v;
+
+                    errno = 0;
+                    v = strtol(value, &end, 10);
+                    if(*value == 0 || *end != 0 || errno != 0)
+                    {
+                        return false;
+                    }
+
+                    *o.intValue = (int)v;
+                }
+                else if(o.stringValue != nullptr)
+                {
+                    *o.stringValue = value;
+                }
+                else
+                {
+                    size_t x;
+
+                    for(x = 0; x < o.choices.size(); x++)
+                    {
+                        if(o.choices[x] == value)
+                        {
+                            break;
+                        }
+                    }
+
+                    if(x == o.choices.size())
+                    {
+                        return false;
+                    }
+
+                    *o.choiceValue = (int)x;
+                }
+
+                return true;
+            }
+
+            return false;
+        }
+
+        std::string             _tool;
+        std::vector<Option_t>   _options;
+    };
+}
+
+#endif // BENCHCOMMON_H
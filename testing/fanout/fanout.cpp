@@ -0,0 +1,464 @@
+//
+//  Copyright (c) 2020 Rally Tactical Systems, Inc.
+//  All rights reserved.
+//
+//  Rallypoint fan-out benchmark
+//
+//  Forwards voice-sized packets from one source to N subscriber links - just as a Rallypoint does
+//  when a packet arrives for a group that N clients and peers have registered for.  Each link is a
+//  stream socket with its own outbound queue and its own framing header (length and link sequence)
+//  in front of every payload.  The packets are forwarded in one of two ways:
+//
+//      copy    - a framed copy of the payload is allocated for each destination and written with
+//                one write() per packet.
+//
+//      shared  - one immutable, reference-counted buffer holds the payload and is queued to every
+//                destination.  Only the per-link header is built per destination, and each link's
+//                queue is flushed with gather writes (writev) of header/payload pairs.
+//
+//  Allocations are counted by replacing the global operator new, so every allocation made while
+//  forwarding - payload buffers, shared_ptr control blocks and queue growth alike - is included.
+//
+//  Build with:
+//
+//      g++ -std=c++11 -O2 -pthread -I../common fanout.cpp -o fanout
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <errno.h>
+#include <unistd.h>
+#include <signal.h>
+#include <limits.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <arpa/inet.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <new>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
+#include "benchcommon.h"
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
+// An immutable payload shared by every outbound queue it is placed on
+typedef std::shared_ptr<const std::vector<uint8_t>> SharedPayload_t;
+
+typedef struct
+{
+    uint32_t                length;
+    uint32_t                sequence;
+} FrameHeader_t;
+
+typedef struct
+{
+    FrameHeader_t           header;
+    SharedPayload_t         payload;
+} SharedItem_t;
+
+typedef struct
+{
+    int                                 txFd;
+    int                                 rxFd;
+    uint32_t                            sequence;
+    std::deque<SharedItem_t>            sharedQueue;
+    std::deque<std::vector<uint8_t>>    copyQueue;
+} Link_t;
+
+typedef struct
+{
+    int                     subscribers;
+    double                  wallSecs;
+    double                  cpuSecs;
+    uint64_t                delivered;
+    uint64_t                writeCalls;
+    uint64_t                allocations;
+    uint64_t                bytesCopied;
+} Result_t;
+
+typedef enum
+{
+    modeCopy = 0,
+    modeShared = 1,
+    modeBoth = 2
+} Mode_t;
+
+static int                  g_packets = 5000;
+static int                  g_payloadSize = 80;
+static int                  g_subscribers = 0;
+static int                  g_burst = 8;
+static int                  g_mode = modeBoth;
+
+static std::atomic<uint64_t> g_rxBytes(0);
+static std::atomic<bool>    g_failed(false);
+
+// Allocations made by the calling thread.  Only the forwarding thread's count is reported.
+static thread_local uint64_t t_allocations = 0;
+
+void *operator new(size_t size)
+{
+    void *p = malloc(size == 0 ? 1 : size);
+
+    if(p == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    t_allocations++;
+
+    return p;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+    free(p);
+}
+
+static void raiseFileLimit()
+{
+    struct rlimit rl;
+
+    if(getrlimit(RLIMIT_NOFILE, &rl) == 0 && rl.rlim_cur < rl.rlim_max)
+    {
+        rl.rlim_cur = rl.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &rl);
+    }
+}
+
+static bool writeFully(int fd, struct iovec *iov, int iovcnt, uint64_t *writeCalls)
+{
+    while(iovcnt > 0)
+    {
+        ssize_t rc = writev(fd, iov, iovcnt);
+
+        (*writeCalls)++;
+
+        if(rc < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+
+            return false;
+        }
+
+        // Skip whatever was written and carry on with the remainder
+        while(iovcnt > 0 && (size_t)rc >= iov->iov_len)
+        {
+            rc -= iov->iov_len;
+            iov++;
+            iovcnt--;
+        }
+
+        if(iovcnt > 0)
+        {
+            iov->iov_base = (uint8_t*)iov->iov_base + rc;
+            iov->iov_len -= rc;
+        }
+    }
+
+    return true;
+}
+
+static bool flushShared(Link_t *link, Result_t *result)
+{
+    struct iovec    iov[IOV_MAX];
+    int             iovcnt = 0;
+
+    while(!link->sharedQueue.empty())
+    {
+        size_t pairs = std::min(link->sharedQueue.size(), (size_t)(IOV_MAX / 2));
+
+        iovcnt = 0;
+        for(size_t x = 0; x < pairs; x++)
+        {
+            SharedItem_t& item = link->sharedQueue[x];
+
+            iov[iovcnt].iov_base = &item.header;
+            iov[iovcnt].iov_len = sizeof(item.header);
+            iovcnt++;
+
+            iov[iovcnt].iov_base = (void*)item.payload->data();
+            iov[iovcnt].iov_len = item.payload->size();
+            iovcnt++;
+        }
+
+        if(!writeFully(link->txFd, iov, iovcnt, &result->writeCalls))
+        {
+            return false;
+        }
+
+        // Releasing the queue entries drops this link's references to the payloads
+        link->sharedQueue.erase(link->sharedQueue.begin(), link->sharedQueue.begin() + pairs);
+    }
+
+    return true;
+}
+
+static bool flushCopy(Link_t *link, Result_t *result)
+{
+    while(!link->copyQueue.empty())
+    {
+        std::vector<uint8_t>& frame = link->copyQueue.front();
+        struct iovec iov;
+
+        iov.iov_base = frame.data();
+        iov.iov_len = frame.size();
+        if(!writeFully(link->txFd, &iov, 1, &result->writeCalls))
+        {
+            return false;
+        }
+
+        link->copyQueue.pop_front();
+    }
+
+    return true;
+}
+
+static void rxThread(std::vector<Link_t> *links, uint64_t expectedBytes)
+{
+    int                             epfd = epoll_create1(0);
+    std::vector<struct epoll_event> events(256);
+    uint8_t                         buff[65536];
+
+    for(size_t x = 0; x < links->size(); x++)
+    {
+        struct epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.fd = (*links)[x].rxFd;
+        epoll_ctl(epfd, EPOLL_CTL_ADD, (*links)[x].rxFd, &ev);
+    }
+
+    while(g_rxBytes < expectedBytes && !g_failed)
+    {
+        int n = epoll_wait(epfd, events.data(), (int)events.size(), 100);
+
+        for(int x = 0; x < n; x++)
+        {
+            ssize_t rc = recv(events[x].data.fd, buff, sizeof(buff), MSG_DONTWAIT);
+
+            if(rc > 0)
+            {
+                g_rxBytes += (uint64_t)rc;
+            }
+        }
+    }
+
+    close(epfd);
+}
+
+static bool runOnce(int subscribers, bool shared, Result_t *result)
+{
+    std::vector<Link_t> links(subscribers);
+
+    memset(result, 0, sizeof(*result));
+    result->subscribers = subscribers;
+
+    for(int x = 0; x < subscribers; x++)
+    {
+        int fds[2];
+
+        if(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+        {
+            std::cout << "ERROR: cannot create link " << x << ": " << strerror(errno) << std::endl;
+            for(int y = 0; y < x; y++)
+            {
+                close(links[y].txFd);
+                close(links[y].rxFd);
+            }
+            return false;
+        }
+
+        links[x].txFd = fds[0];
+        links[x].rxFd = fds[1];
+        links[x].sequence = 0;
+    }
+
+    uint64_t frameSize = sizeof(FrameHeader_t) + (uint64_t)g_payloadSize;
+    uint64_t expectedBytes = frameSize * (uint64_t)g_packets * (uint64_t)subscribers;
+
+    g_rxBytes = 0;
+    g_failed = false;
+    std::thread rx(rxThread, &links, expectedBytes);
+
+    // The "received" packet that every iteration forwards
+    std::vector<uint8_t> inbound(g_payloadSize, 0x42);
+
+    double cpuStart = BenchCommon::cpuSecs();
+    uint64_t allocationsStart = t_allocations;
+    auto wallStart = std::chrono::steady_clock::now();
+
+    for(int p = 0; p < g_packets && !g_failed; p++)
+    {
+        if(shared)
+        {
+            SharedPayload_t payload = std::make_shared<const std::vector<uint8_t>>(inbound);
+
+            result->bytesCopied += inbound.size();
+
+            for(Link_t& link : links)
+            {
+                SharedItem_t item;
+
+                item.header.length = htonl((uint32_t)payload->size());
+                item.header.sequence = htonl(link.sequence++);
+                item.payload = payload;
+                link.sharedQueue.push_back(std::move(item));
+            }
+        }
+        else
+        {
+            for(Link_t& link : links)
+            {
+                std::vector<uint8_t> frame(frameSize);
+                FrameHeader_t hdr;
+
+                hdr.length = htonl((uint32_t)inbound.size());
+                hdr.sequence = htonl(link.sequence++);
+                memcpy(frame.data(), &hdr, sizeof(hdr));
+                memcpy(frame.data() + sizeof(hdr), inbound.data(), inbound.size());
+
+                result->bytesCopied += inbound.size();
+
+                link.copyQueue.push_back(std::move(frame));
+            }
+        }
+
+        if(((p + 1) % g_burst) == 0 || p == g_packets - 1)
+        {
+            for(size_t x = 0; x < links.size(); x++)
+            {
+                bool ok = (shared ? flushShared(&links[x], result) : flushCopy(&links[x], result));
+
+                if(!ok)
+                {
+                    std::cout << "ERROR: write to link " << x << " failed: " << strerror(errno) << std::endl;
+                    g_failed = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    result->allocations = t_allocations - allocationsStart;
+
+    rx.join();
+
+    result->wallSecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    result->cpuSecs = BenchCommon::cpuSecs() - cpuStart;
+    result->delivered = (uint64_t)g_packets * (uint64_t)subscribers;
+
+    for(Link_t& link : links)
+    {
+        close(link.txFd);
+        close(link.rxFd);
+    }
+
+    return !g_failed;
+}
+
+static void report(const char *mode, const Result_t& r)
+{
+    printf("%-7s 1->%-5d delivered %10" PRIu64 "  %9.0f pps  %7.3f us cpu/packet  %7.2f packets/write  %6.2f allocs/source packet  %8.1f bytes copied/source packet\n",
+            mode,
+            r.subscribers,
+            r.delivered,
+            r.wallSecs > 0.0 ? (double)r.delivered / r.wallSecs : 0.0,
+            r.delivered ? (r.cpuSecs * 1000000.0) / (double)r.delivered : 0.0,
+            r.writeCalls ? (double)r.delivered / (double)r.writeCalls : 0.0,
+            g_packets ? (double)r.allocations / (double)g_packets : 0.0,
+            g_packets ? (double)r.bytesCopied / (double)g_packets : 0.0);
+}
+
+int main(int argc, const char *argv[])
+{
+    BenchCommon::Options options("fanout");
+
+    options.addChoice("mode", {"copy", "shared", "both"}, &g_mode, "forwarding method");
+    options.addInt("subscribers", "<count>", &g_subscribers, "subscribers per group", "runs 10, 100 and 1000");
+    options.addInt("packets", "<count>", &g_packets, "source packets to forward per run");
+    options.addInt("size", "<bytes>", &g_payloadSize, "payload size");
+    options.addInt("burst", "<count>", &g_burst, "packets queued to each link before it is flushed");
+
+    if(!options.parse(argc, argv))
+    {
+        return 1;
+    }
+
+    if(g_packets <= 0 || g_payloadSize <= 0 || g_burst <= 0 || g_subscribers < 0)
+    {
+        options.showUsage();
+        return 1;
+    }
+
+    raiseFileLimit();
+
+    // A failed write is reported and ends the run rather than killing the process
+    signal(SIGPIPE, SIG_IGN);
+
+    std::vector<int> sweep;
+    if(g_subscribers > 0)
+    {
+        sweep.push_back(g_subscribers);
+    }
+    else
+    {
+        sweep.push_back(10);
+        sweep.push_back(100);
+        sweep.push_back(1000);
+    }
+
+    std::cout << "fanout: packets=" << g_packets
+              << ", size=" << g_payloadSize
+              << ", burst=" << g_burst << std::endl;
+
+    for(int subscribers : sweep)
+    {
+        Result_t r;
+
+        if(g_mode != modeShared)
+        {
+            if(!runOnce(subscribers, false, &r))
+            {
+                return 1;
+            }
+            report("copy", r);
+        }
+
+        if(g_mode != modeCopy)
+        {
+            if(!runOnce(subscribers, true, &r))
+            {
+                return 1;
+            }
+            report("shared", r);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,675 @@
+//
+//  Copyright (c) 2020 Rally Tactical Systems, Inc.
+//  All rights reserved.
+//
+//  Rallypoint group subscription index benchmark
+//
+//  Builds the table a Rallypoint uses to find the links registered for a group, loads it with a
+//  synthetic population (100,000 groups and 10,000 clients by default), and then has forwarding
+//  threads look up subscribers for random groups while a churn thread keeps registering and
+//  unregistering clients.  The table is built in one of two ways:
+//
+//      map     - a std::map keyed by group id string, holding a std::set of link ids per group and
+//                guarded by a mutex that forwarding and registration both take.
+//
+//      index   - group ids are interned into dense indexes.  Each index has a slot pointing to an
+//                immutable, contiguous vector of link ids.  Registration changes copy the vector,
+//                publish the new one with an atomic store, and retire the old one until every
+//                forwarding thread has passed a quiescent point (RCU-style).  Forwarding threads
+//                never take a lock.
+//
+//  Every lookup in both modes starts from the group id string, just as a packet does, so both
+//  pay for resolving it.  After each run the table is checked, group by group, against a model
+//  built by replaying the same registrations, and the modes are only compared if both pass.
+//
+//  Build with:
+//
+//      g++ -std=c++11 -O2 -pthread -I../common groupindex.cpp -o groupindex
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <unistd.h>
+#include <malloc.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+
+#include "benchcommon.h"
+
+// An immutable list of the links registered for a group
+typedef struct
+{
+    std::vector<uint32_t>   links;
+} SubscriberList_t;
+
+typedef struct
+{
+    const SubscriberList_t  *list;
+    uint64_t                epoch;
+} Retired_t;
+
+// Kept on its own cache line so that forwarding threads don't share the line they write to
+struct alignas(64) Reader_t
+{
+    std::atomic<uint64_t>   quiescentEpoch;
+    uint64_t                lookups;
+    uint64_t                linksVisited;
+    uint64_t                digest;
+    std::vector<uint32_t>   samplesNs;
+};
+
+typedef struct
+{
+    bool                    verified;
+    uint64_t                populatedDigest;
+    uint64_t                finalDigest;
+    double                  lookupsPerSec;
+    uint32_t                p50;
+    uint32_t                p99;
+} Result_t;
+
+typedef enum
+{
+    modeMap = 0,
+    modeIndex = 1,
+    modeBoth = 2
+} Mode_t;
+
+static const uint64_t       POPULATE_SEED = 0x9e3779b97f4a7c15ULL;
+static const uint64_t       CHURN_SEED = 0x853c49e6748fea9bULL;
+
+static int                  g_groups = 100000;
+static int                  g_clients = 10000;
+static int                  g_groupsPerClient = 20;
+static int                  g_readers = 0;
+static int                  g_secs = 10;
+static int                  g_churnPerSec = 10000;
+static int                  g_mode = modeBoth;
+
+static bool                 g_index = true;
+static std::atomic<bool>    g_running(true);
+static std::vector<std::string>                     g_groupIds;
+
+// map
+static std::mutex                                   g_mapLock;
+static std::map<std::string, std::set<uint32_t>>    g_map;
+
+// index
+static std::unordered_map<std::string, uint32_t>    g_interned;
+static std::vector<std::atomic<const SubscriberList_t*>> *g_slots = nullptr;
+static std::atomic<uint64_t>                        g_epoch(1);
+static std::vector<Retired_t>                       g_retired;
+static uint64_t                                     g_retiredCount = 0;
+static uint64_t                                     g_freed = 0;
+
+static inline uint64_t xorshift(uint64_t *state)
+{
+    uint64_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+
+    return x;
+}
+
+// Order-independent contribution of one link to a group's digest
+static inline uint64_t linkDigest(uint32_t link)
+{
+    return ((uint64_t)link + 1) * 0x9e3779b97f4a7c15ULL;
+}
+
+static uint64_t rssKb()
+{
+    long pages = 0;
+    long resident = 0;
+    FILE *fp = fopen("/proc/self/statm", "r");
+
+    if(fp != nullptr)
+    {
+        if(fscanf(fp, "%ld %ld", &pages, &resident) != 2)
+        {
+            resident = 0;
+        }
+        fclose(fp);
+    }
+
+    return (uint64_t)resident * (uint64_t)sysconf(_SC_PAGESIZE) / 1024;
+}
+
+// The lookup a forwarding thread makes for each packet: resolve the group id, then visit every subscriber
+static size_t lookupMap(const std::string& groupId, uint64_t *digest)
+{
+    std::lock_guard<std::mutex> lock(g_mapLock);
+    auto itr = g_map.find(groupId);
+
+    if(itr == g_map.end())
+    {
+        return 0;
+    }
+
+    for(uint32_t link : itr->second)
+    {
+        *digest += linkDigest(link);
+    }
+
+    return itr->second.size();
+}
+
+static size_t lookupIndex(const std::string& groupId, uint64_t *digest)
+{
+    auto itr = g_interned.find(groupId);
+
+    if(itr == g_interned.end())
+    {
+        return 0;
+    }
+
+    const SubscriberList_t *list = (*g_slots)[itr->second].load(std::memory_order_acquire);
+
+    if(list == nullptr)
+    {
+        return 0;
+    }
+
+    for(uint32_t link : list->links)
+    {
+        *digest += linkDigest(link);
+    }
+
+    return list->links.size();
+}
+
+static inline size_t lookup(const std::string& groupId, uint64_t *digest)
+{
+    return (g_index ? lookupIndex(groupId, digest) : lookupMap(groupId, digest));
+}
+
+static void reclaim(std::vector<Reader_t> *readers)
+{
+    uint64_t oldest = UINT64_MAX;
+
+    for(Reader_t& r : *readers)
+    {
+        oldest = std::min(oldest, r.quiescentEpoch.load());
+    }
+
+    // Anything retired before the oldest quiescent point can no longer be in use
+    size_t kept = 0;
+    for(size_t x = 0; x < g_retired.size(); x++)
+    {
+        if(g_retired[x].epoch < oldest)
+        {
+            delete g_retired[x].list;
+            g_freed++;
+        }
+        else
+        {
+            g_retired[kept++] = g_retired[x];
+        }
+    }
+
+    g_retired.resize(kept);
+}
+
+// Adds the link if it is not registered for the group, removes it if it is
+static void toggleIndex(const std::string& groupId, uint32_t link)
+{
+    std::atomic<const SubscriberList_t*>& slot = (*g_slots)[g_interned.at(groupId)];
+    const SubscriberList_t *current = slot.load();
+    SubscriberList_t *replacement = new SubscriberList_t();
+
+    if(current != nullptr)
+    {
+        replacement->links.reserve(current->links.size() + 1);
+        for(uint32_t l : current->links)
+        {
+            if(l != link)
+            {
+                replacement->links.push_back(l);
+            }
+        }
+
+        if(replacement->links.size() == current->links.size())
+        {
+            replacement->links.push_back(link);
+        }
+    }
+    else
+    {
+        replacement->links.push_back(link);
+    }
+
+    slot.store(replacement, std::memory_order_release);
+
+    if(current != nullptr)
+    {
+        Retired_t r;
+        r.list = current;
+        r.epoch = g_epoch.fetch_add(1);
+        g_retired.push_back(r);
+        g_retiredCount++;
+    }
+}
+
+static void toggleMap(const std::string& groupId, uint32_t link)
+{
+    std::lock_guard<std::mutex> lock(g_mapLock);
+    std::set<uint32_t>& links = g_map[groupId];
+
+    if(links.erase(link) == 0)
+    {
+        links.insert(link);
+    }
+}
+
+// The registrations every run starts from: each client registers for g_groupsPerClient random groups
+template<typename F> static void forEachInitialRegistration(F register_)
+{
+    uint64_t seed = POPULATE_SEED;
+
+    for(int c = 0; c < g_clients; c++)
+    {
+        for(int x = 0; x < g_groupsPerClient; x++)
+        {
+            register_((uint32_t)(xorshift(&seed) % (uint64_t)g_groups), (uint32_t)c);
+        }
+    }
+}
+
+// The registration changes made by the churn thread, in order
+static void nextChurn(uint64_t *seed, uint32_t *group, uint32_t *link)
+{
+    *group = (uint32_t)(xorshift(seed) % (uint64_t)g_groups);
+    *link = (uint32_t)(xorshift(seed) % (uint64_t)g_clients);
+}
+
+static void populate()
+{
+    if(g_index)
+    {
+        // Every group is interned up front so that the intern table is read-only while forwarding threads use it
+        g_interned.reserve(g_groups);
+        for(int x = 0; x < g_groups; x++)
+        {
+            g_interned[g_groupIds[x]] = (uint32_t)x;
+        }
+
+        g_slots = new std::vector<std::atomic<const SubscriberList_t*>>(g_groups);
+        for(auto& slot : *g_slots)
+        {
+            slot.store(nullptr);
+        }
+    }
+
+    forEachInitialRegistration([](uint32_t group, uint32_t link)
+    {
+        if(g_index)
+        {
+            const SubscriberList_t *current = (*g_slots)[g_interned.at(g_groupIds[group])].load();
+
+            if(current == nullptr || std::find(current->links.begin(), current->links.end(), link) == current->links.end())
+            {
+                toggleIndex(g_groupIds[group], link);
+            }
+        }
+        else
+        {
+            g_map[g_groupIds[group]].insert(link);
+        }
+    });
+
+    // Nothing is reading yet so the population's retired lists can go straight away
+    for(Retired_t& r : g_retired)
+    {
+        delete r.list;
+    }
+    g_retired.clear();
+    g_retiredCount = 0;
+}
+
+static void teardown()
+{
+    g_map.clear();
+
+    if(g_slots != nullptr)
+    {
+        for(auto& slot : *g_slots)
+        {
+            delete slot.load();
+        }
+        delete g_slots;
+        g_slots = nullptr;
+    }
+
+    for(Retired_t& r : g_retired)
+    {
+        delete r.list;
+    }
+    g_retired.clear();
+    g_interned.clear();
+    g_retiredCount = 0;
+    g_freed = 0;
+
+    malloc_trim(0);
+}
+
+static void readerThread(Reader_t *me, int id)
+{
+    uint64_t seed = 0x2545f4914f6cdd1dULL + (uint64_t)id;
+    uint64_t digest = 0;
+
+    while(g_running)
+    {
+        // A batch of lookups between quiescent points
+        for(int x = 0; x < 1024; x++)
+        {
+            const std::string& groupId = g_groupIds[xorshift(&seed) % (uint64_t)g_groups];
+            bool sample = ((x & 127) == 0);
+            auto start = std::chrono::steady_clock::now();
+            size_t visited = lookup(groupId, &digest);
+
+            if(sample)
+            {
+                me->samplesNs.push_back((uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+            }
+
+            me->lookups++;
+            me->linksVisited += visited;
+        }
+
+        me->quiescentEpoch.store(g_epoch.load());
+    }
+
+    // Kept so that the lookups can't be optimized away
+    me->digest = digest;
+}
+
+static void churnThread(std::vector<Reader_t> *readers, uint64_t *changes)
+{
+    uint64_t seed = CHURN_SEED;
+    auto next = std::chrono::steady_clock::now();
+    int perTick = std::max(1, g_churnPerSec / 100);
+
+    while(g_running)
+    {
+        for(int x = 0; x < perTick; x++)
+        {
+            uint32_t group;
+            uint32_t link;
+
+            nextChurn(&seed, &group, &link);
+
+            if(g_index)
+            {
+                toggleIndex(g_groupIds[group], link);
+            }
+            else
+            {
+                toggleMap(g_groupIds[group], link);
+            }
+
+            (*changes)++;
+        }
+
+        if(g_index)
+        {
+            reclaim(readers);
+        }
+
+        next += std::chrono::milliseconds(10);
+        std::this_thread::sleep_until(next);
+    }
+}
+
+// Replays the same registrations and changes into a plain model and compares every group's subscribers with it
+static bool verify(uint64_t changes, uint64_t *tableDigest)
+{
+    std::vector<std::set<uint32_t>> model(g_groups);
+    uint64_t seed = CHURN_SEED;
+
+    forEachInitialRegistration([&model](uint32_t group, uint32_t link)
+    {
+        model[group].insert(link);
+    });
+
+    for(uint64_t x = 0; x < changes; x++)
+    {
+        uint32_t group;
+        uint32_t link;
+
+        nextChurn(&seed, &group, &link);
+
+        if(model[group].erase(link) == 0)
+        {
+            model[group].insert(link);
+        }
+    }
+
+    *tableDigest = 0;
+
+    for(int g = 0; g < g_groups; g++)
+    {
+        uint64_t expected = 0;
+        uint64_t actual = 0;
+
+        for(uint32_t link : model[g])
+        {
+            expected += linkDigest(link);
+        }
+
+        size_t count = lookup(g_groupIds[g], &actual);
+
+        if(count != model[g].size() || actual != expected)
+        {
+            printf("verify ............... FAILED at group %d: %zu links, expected %zu\n", g, count, model[g].size());
+            return false;
+        }
+
+        *tableDigest = (*tableDigest * 31) + expected + count;
+    }
+
+    return true;
+}
+
+static void runOnce(bool index, Result_t *result)
+{
+    g_index = index;
+    g_running = true;
+    g_epoch = 1;
+
+    std::cout << "groupindex: mode=" << (g_index ? "index" : "map")
+              << ", groups=" << g_groups
+              << ", clients=" << g_clients
+              << ", gpc=" << g_groupsPerClient
+              << ", readers=" << g_readers
+              << ", churn=" << g_churnPerSec << "/s"
+              << ", secs=" << g_secs << std::endl;
+
+    uint64_t rssBefore = rssKb();
+    auto populateStart = std::chrono::steady_clock::now();
+    populate();
+    double populateSecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - populateStart).count();
+    uint64_t rssAfter = rssKb();
+
+    result->verified = verify(0, &result->populatedDigest);
+    if(!result->verified)
+    {
+        teardown();
+        return;
+    }
+
+    std::vector<Reader_t> readers(g_readers);
+    for(Reader_t& r : readers)
+    {
+        r.quiescentEpoch.store(g_epoch.load());
+        r.lookups = 0;
+        r.linksVisited = 0;
+        r.digest = 0;
+        r.samplesNs.reserve(1 << 20);
+    }
+
+    uint64_t changes = 0;
+    double cpuStart = BenchCommon::cpuSecs();
+    auto wallStart = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for(int x = 0; x < g_readers; x++)
+    {
+        threads.push_back(std::thread(readerThread, &readers[x], x));
+    }
+
+    std::thread churn;
+    if(g_churnPerSec > 0)
+    {
+        churn = std::thread(churnThread, &readers, &changes);
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(g_secs));
+    g_running = false;
+
+    for(std::thread& t : threads)
+    {
+        t.join();
+    }
+
+    if(churn.joinable())
+    {
+        churn.join();
+    }
+
+    double wallSecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    double cpuUsed = BenchCommon::cpuSecs() - cpuStart;
+
+    uint64_t lookups = 0;
+    uint64_t visited = 0;
+    std::vector<uint32_t> samples;
+
+    for(Reader_t& r : readers)
+    {
+        lookups += r.lookups;
+        visited += r.linksVisited;
+        samples.insert(samples.end(), r.samplesNs.begin(), r.samplesNs.end());
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    uint32_t p50 = samples.empty() ? 0 : samples[samples.size() / 2];
+    uint32_t p99 = samples.empty() ? 0 : samples[(samples.size() * 99) / 100];
+    uint32_t p999 = samples.empty() ? 0 : samples[(samples.size() * 999) / 1000];
+    uint32_t pmax = samples.empty() ? 0 : samples.back();
+
+    printf("populate ............. %.3f secs, %" PRIu64 " KB resident for the table\n", populateSecs, rssAfter > rssBefore ? rssAfter - rssBefore : 0);
+    printf("lookups .............. %" PRIu64 " (%.0f/sec, %.2f links per lookup)\n", lookups, wallSecs > 0.0 ? (double)lookups / wallSecs : 0.0, lookups ? (double)visited / (double)lookups : 0.0);
+    printf("lookup latency ....... p50 %u ns, p99 %u ns, p99.9 %u ns, max %u ns\n", p50, p99, p999, pmax);
+    printf("registration changes . %" PRIu64 "\n", changes);
+    if(g_index)
+    {
+        printf("lists retired/freed .. %" PRIu64 "/%" PRIu64 "\n", g_retiredCount, g_freed);
+    }
+    printf("cpu .................. %.3f secs (%.1f ns/lookup)\n", cpuUsed, lookups ? (cpuUsed * 1000000000.0) / (double)lookups : 0.0);
+
+    result->verified = verify(changes, &result->finalDigest);
+    if(result->verified)
+    {
+        printf("verify ............... ok, populated %016" PRIx64 ", final %016" PRIx64 "\n", result->populatedDigest, result->finalDigest);
+    }
+
+    result->lookupsPerSec = wallSecs > 0.0 ? (double)lookups / wallSecs : 0.0;
+    result->p50 = p50;
+    result->p99 = p99;
+
+    teardown();
+}
+
+int main(int argc, const char *argv[])
+{
+    BenchCommon::Options options("groupindex");
+
+    options.addChoice("mode", {"map", "index", "both"}, &g_mode, "subscription table to use");
+    options.addInt("groups", "<count>", &g_groups, "number of groups");
+    options.addInt("clients", "<count>", &g_clients, "number of client links");
+    options.addInt("gpc", "<count>", &g_groupsPerClient, "groups each client registers for");
+    options.addInt("readers", "<count>", &g_readers, "forwarding threads", "1 per CPU core");
+    options.addInt("churn", "<count>", &g_churnPerSec, "registration changes per second");
+    options.addInt("secs", "<seconds>", &g_secs, "duration of each run");
+
+    if(!options.parse(argc, argv))
+    {
+        return 1;
+    }
+
+    if(g_readers <= 0)
+    {
+        g_readers = std::max(1, (int)std::thread::hardware_concurrency());
+    }
+
+    if(g_groups <= 0 || g_clients <= 0 || g_groupsPerClient <= 0 || g_churnPerSec < 0 || g_secs <= 0)
+    {
+        options.showUsage();
+        return 1;
+    }
+
+    g_groupIds.resize(g_groups);
+    for(int x = 0; x < g_groups; x++)
+    {
+        char tmp[64];
+        snprintf(tmp, sizeof(tmp), "{group-%08d-0000-0000-0000-000000000000}", x);
+        g_groupIds[x] = tmp;
+    }
+
+    Result_t mapResult;
+    Result_t indexResult;
+
+    if(g_mode != modeIndex)
+    {
+        runOnce(false, &mapResult);
+        if(!mapResult.verified)
+        {
+            return 1;
+        }
+    }
+
+    if(g_mode != modeMap)
+    {
+        if(g_mode == modeBoth)
+        {
+            printf("\n");
+        }
+
+        runOnce(true, &indexResult);
+        if(!indexResult.verified)
+        {
+            return 1;
+        }
+    }
+
+    if(g_mode == modeBoth)
+    {
+        // Both tables are loaded from the same registrations so they must start out identical
+        if(mapResult.populatedDigest != indexResult.populatedDigest)
+        {
+            printf("\nERROR: the map and index tables do not hold the same subscribers\n");
+            return 1;
+        }
+
+        printf("\nindex vs map ......... %.2fx lookups/sec, p50 %u vs %u ns, p99 %u vs %u ns\n",
+               mapResult.lookupsPerSec > 0.0 ? indexResult.lookupsPerSec / mapResult.lookupsPerSec : 0.0,
+               indexResult.p50, mapResult.p50, indexResult.p99, mapResult.p99);
+    }
+
+    return 0;
+}
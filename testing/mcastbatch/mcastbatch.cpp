@@ -0,0 +1,595 @@
+//
+//  Copyright (c) 2020 Rally Tactical Systems, Inc.
+//  All rights reserved.
+//
+//  Multicast batching benchmark
+//
+//  Replays Engage-like multicast voice traffic (one stream per group, one RTP-sized datagram every
+//  framing interval) on the loopback interface and receives it on one socket per group - just as
+//  the Engine does for groups with multicast rx/tx addresses.  The same traffic is run through
+//  one of three I/O methods so that they can be compared for system call count and CPU cost per
+//  packet:
+//
+//      single  - one datagram per syscall (sendto/recv).
+//
+//      batch   - many datagrams per syscall (sendmmsg/recvmmsg).
+//
+//      gso     - as batch, but each group's datagrams for an interval leave as one UDP_SEGMENT
+//                send, and receive sockets have UDP_GRO set so that the kernel can hand them up
+//                coalesced.
+//
+//  Build with:
+//
+//      g++ -std=c++11 -O2 -pthread -I../common mcastbatch.cpp -o mcastbatch
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/epoll.h>
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <arpa/inet.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
+#include "benchcommon.h"
+
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+
+#define HISTOGRAM_SLOTS     8       // 1, 2, 3-4, 5-8, 9-16, 17-32, 33-64, 65+
+
+typedef enum
+{
+    modeSingle = 0,
+    modeBatch = 1,
+    modeGso = 2
+} Mode_t;
+
+typedef struct
+{
+    int                     fd;
+    int                     group;
+    uint64_t                syscalls;
+    uint64_t                packets;
+    uint64_t                coalesced;              // GRO reads that carried more than one datagram
+    uint64_t                batchHistogram[HISTOGRAM_SLOTS];
+} RxSocket_t;
+
+static int                  g_mode = modeSingle;
+static int                  g_groups = 100;
+static int                  g_framingMs = 20;
+static int                  g_secs = 10;
+static int                  g_payloadSize = 80;
+static int                  g_burst = 1;
+static int                  g_batch = 32;
+static int                  g_drainMs = 500;
+static int                  g_perSocket = 1;
+static std::string          g_baseAddress = "239.42.0.1";
+static int                  g_port = 30000;
+
+static std::atomic<bool>    g_running(true);
+static uint64_t             g_txSyscalls = 0;
+static uint64_t             g_txPackets = 0;
+
+static int histogramSlot(int n)
+{
+    int slot = 0;
+    int limit = 1;
+
+    while(slot < (HISTOGRAM_SLOTS - 1) && n > limit)
+    {
+        slot++;
+        limit *= 2;
+    }
+
+    return slot;
+}
+
+static bool groupAddress(int index, struct sockaddr_in *sa)
+{
+    struct in_addr base;
+
+    if(inet_pton(AF_INET, g_baseAddress.c_str(), &base) != 1)
+    {
+        return false;
+    }
+
+    memset(sa, 0, sizeof(*sa));
+    sa->sin_family = AF_INET;
+    sa->sin_addr.s_addr = htonl(ntohl(base.s_addr) + (uint32_t)index);
+    sa->sin_port = htons((uint16_t)g_port);
+
+    return true;
+}
+
+static int openRxSocket(int index)
+{
+    struct sockaddr_in  sa;
+    struct ip_mreq      mreq;
+    int                 one = 1;
+    int                 fd;
+
+    if(!groupAddress(index, &sa))
+    {
+        return -1;
+    }
+
+    fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if(fd < 0)
+    {
+        return -1;
+    }
+
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    if(g_mode == modeGso && setsockopt(fd, IPPROTO_UDP, UDP_GRO, &one, sizeof(one)) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    // Bind to the group address so that each socket only receives its own group's traffic
+    if(bind(fd, (struct sockaddr*)&sa, sizeof(sa)) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    memset(&mreq, 0, sizeof(mreq));
+    mreq.imr_multiaddr = sa.sin_addr;
+    mreq.imr_interface.s_addr = htonl(INADDR_LOOPBACK);
+    if(setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+
+    return fd;
+}
+
+static int openTxSocket()
+{
+    struct in_addr      intf;
+    unsigned char       loop = 1;
+    unsigned char       ttl = 1;
+    int                 fd;
+
+    fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if(fd < 0)
+    {
+        return -1;
+    }
+
+    intf.s_addr = htonl(INADDR_LOOPBACK);
+    setsockopt(fd, IPPROTO_IP, IP_MULTICAST_IF, &intf, sizeof(intf));
+    setsockopt(fd, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop));
+    setsockopt(fd, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl));
+
+    return fd;
+}
+
+// Sends msgs[0..count) in sendmmsg calls of at most g_batch messages, each message carrying perMessage datagrams
+static void sendBatched(int fd, std::vector<struct mmsghdr>& msgs, int count, int perMessage)
+{
+    int sent = 0;
+
+    while(sent < count)
+    {
+        int chunk = std::min(g_batch, count - sent);
+        int rc = sendmmsg(fd, &msgs[sent], (unsigned int)chunk, 0);
+
+        g_txSyscalls++;
+
+        if(rc <= 0)
+        {
+            break;
+        }
+
+        sent += rc;
+        g_txPackets += (uint64_t)rc * (uint64_t)perMessage;
+    }
+}
+
+static void txThread(int fd)
+{
+    std::vector<struct sockaddr_in>     destinations(g_groups);
+    std::vector<uint8_t>                payload(g_payloadSize * g_burst, 0x42);
+    std::vector<struct mmsghdr>         msgs;
+    std::vector<struct iovec>           iovs;
+    std::vector<uint8_t>                controls;
+    size_t                              controlSize = CMSG_SPACE(sizeof(uint16_t));
+
+    for(int x = 0; x < g_groups; x++)
+    {
+        groupAddress(x, &destinations[x]);
+    }
+
+    // batch: one message per datagram.  gso: one message per group holding all of its datagrams.
+    int messages = (g_mode == modeGso ? g_groups : g_groups * g_burst);
+
+    msgs.resize(messages);
+    iovs.resize(messages);
+    controls.resize(messages * controlSize, 0);
+
+    for(int x = 0; x < messages; x++)
+    {
+        memset(&msgs[x], 0, sizeof(msgs[x]));
+
+        if(g_mode == modeGso)
+        {
+            iovs[x].iov_base = payload.data();
+            iovs[x].iov_len = payload.size();
+
+            msgs[x].msg_hdr.msg_name = &destinations[x];
+            msgs[x].msg_hdr.msg_control = &controls[x * controlSize];
+            msgs[x].msg_hdr.msg_controllen = controlSize;
+
+            struct cmsghdr *cm = CMSG_FIRSTHDR(&msgs[x].msg_hdr);
+            cm->cmsg_level = SOL_UDP;
+            cm->cmsg_type = UDP_SEGMENT;
+            cm->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+            *((uint16_t*)CMSG_DATA(cm)) = (uint16_t)g_payloadSize;
+        }
+        else
+        {
+            iovs[x].iov_base = payload.data();
+            iovs[x].iov_len = g_payloadSize;
+
+            msgs[x].msg_hdr.msg_name = &destinations[x / g_burst];
+        }
+
+        msgs[x].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+        msgs[x].msg_hdr.msg_iov = &iovs[x];
+        msgs[x].msg_hdr.msg_iovlen = 1;
+    }
+
+    auto next = std::chrono::steady_clock::now();
+
+    while(g_running)
+    {
+        if(g_mode == modeBatch)
+        {
+            sendBatched(fd, msgs, messages, 1);
+        }
+        else if(g_mode == modeGso)
+        {
+            sendBatched(fd, msgs, messages, g_burst);
+        }
+        else
+        {
+            for(int x = 0; x < g_groups; x++)
+            {
+                for(int y = 0; y < g_burst; y++)
+                {
+                    ssize_t rc = sendto(fd, payload.data(), g_payloadSize, 0, (struct sockaddr*)&destinations[x], sizeof(destinations[x]));
+
+                    g_txSyscalls++;
+
+                    if(rc > 0)
+                    {
+                        g_txPackets++;
+                    }
+                }
+            }
+        }
+
+        next += std::chrono::milliseconds(g_framingMs);
+        std::this_thread::sleep_until(next);
+    }
+}
+
+static void drainSingle(RxSocket_t *s, uint8_t *buff, size_t buffSize)
+{
+    int count = 0;
+
+    while(true)
+    {
+        ssize_t rc = recv(s->fd, buff, buffSize, 0);
+
+        s->syscalls++;
+
+        if(rc < 0)
+        {
+            break;
+        }
+
+        count++;
+    }
+
+    if(count > 0)
+    {
+        s->packets += count;
+        s->batchHistogram[histogramSlot(count)]++;
+    }
+}
+
+// Number of datagrams carried by a received message - more than one only if GRO coalesced them
+static int datagramsIn(struct mmsghdr *m)
+{
+    struct cmsghdr *cm;
+
+    for(cm = CMSG_FIRSTHDR(&m->msg_hdr); cm != nullptr; cm = CMSG_NXTHDR(&m->msg_hdr, cm))
+    {
+        if(cm->cmsg_level == SOL_UDP && cm->cmsg_type == UDP_GRO)
+        {
+            int segmentSize = *((int*)CMSG_DATA(cm));
+
+            if(segmentSize > 0)
+            {
+                return (int)((m->msg_len + (unsigned int)segmentSize - 1) / (unsigned int)segmentSize);
+            }
+        }
+    }
+
+    return 1;
+}
+
+static void drainBatched(RxSocket_t *s, std::vector<struct mmsghdr>& msgs, size_t controlSize)
+{
+    int count = 0;
+
+    while(true)
+    {
+        // recvmmsg overwrites msg_controllen so it has to be reset before every call
+        for(struct mmsghdr& m : msgs)
+        {
+            m.msg_hdr.msg_controllen = controlSize;
+        }
+
+        int rc = recvmmsg(s->fd, msgs.data(), (unsigned int)msgs.size(), 0, nullptr);
+
+        s->syscalls++;
+
+        if(rc <= 0)
+        {
+            break;
+        }
+
+        for(int x = 0; x < rc; x++)
+        {
+            int datagrams = datagramsIn(&msgs[x]);
+
+            if(datagrams > 1)
+            {
+                s->coalesced++;
+            }
+
+            count += datagrams;
+        }
+
+        // A short batch means the socket's queue has been drained
+        if(rc < (int)msgs.size())
+        {
+            break;
+        }
+    }
+
+    if(count > 0)
+    {
+        s->packets += count;
+        s->batchHistogram[histogramSlot(count)]++;
+    }
+}
+
+static void printHistogram(const uint64_t *histogram)
+{
+    static const char *slotNames[HISTOGRAM_SLOTS] = {"1", "2", "3-4", "5-8", "9-16", "17-32", "33-64", "65+"};
+
+    for(int y = 0; y < HISTOGRAM_SLOTS; y++)
+    {
+        printf(" %s:%" PRIu64, slotNames[y], histogram[y]);
+    }
+    printf("\n");
+}
+
+int main(int argc, const char *argv[])
+{
+    BenchCommon::Options options("mcastbatch");
+
+    options.addChoice("mode", {"single", "batch", "gso"}, &g_mode, "I/O method");
+    options.addInt("groups", "<count>", &g_groups, "number of multicast groups");
+    options.addInt("framing", "<ms>", &g_framingMs, "interval between sends to each group");
+    options.addInt("burst", "<count>", &g_burst, "datagrams sent to each group per interval");
+    options.addInt("secs", "<seconds>", &g_secs, "duration of the run");
+    options.addInt("size", "<bytes>", &g_payloadSize, "datagram payload size");
+    options.addInt("batch", "<count>", &g_batch, "maximum messages per batched syscall");
+    options.addInt("drain", "<ms>", &g_drainMs, "longest wait for in-flight datagrams after sending stops");
+    options.addInt("persocket", "<0|1>", &g_perSocket, "report each socket's batch sizes");
+    options.addString("base", "<address>", &g_baseAddress, "first multicast address");
+    options.addInt("port", "<port>", &g_port, "udp port");
+
+    if(!options.parse(argc, argv))
+    {
+        return 1;
+    }
+
+    if(g_groups <= 0 || g_framingMs <= 0 || g_secs <= 0 || g_payloadSize <= 0 || g_batch <= 0 || g_burst <= 0 || g_drainMs < 0)
+    {
+        options.showUsage();
+        return 1;
+    }
+
+    if(g_mode == modeGso && (g_burst > 64 || g_payloadSize * g_burst > 65000))
+    {
+        std::cout << "ERROR: a UDP_SEGMENT send carries at most 64 datagrams and 65000 bytes" << std::endl;
+        return 1;
+    }
+
+    int epfd = epoll_create1(0);
+    std::vector<RxSocket_t> sockets(g_groups);
+
+    for(int x = 0; x < g_groups; x++)
+    {
+        memset(&sockets[x], 0, sizeof(sockets[x]));
+        sockets[x].group = x;
+        sockets[x].fd = openRxSocket(x);
+        if(sockets[x].fd < 0)
+        {
+            std::cout << "ERROR: cannot open receive socket for group " << x << ": " << strerror(errno) << std::endl;
+            return 1;
+        }
+
+        struct epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.ptr = &sockets[x];
+        epoll_ctl(epfd, EPOLL_CTL_ADD, sockets[x].fd, &ev);
+    }
+
+    int txfd = openTxSocket();
+    if(txfd < 0)
+    {
+        std::cout << "ERROR: cannot open transmit socket: " << strerror(errno) << std::endl;
+        return 1;
+    }
+
+    // Receive buffers for the batched paths - big enough for a fully coalesced GRO read
+    size_t                              rxControlSize = CMSG_SPACE(sizeof(int));
+    std::vector<std::vector<uint8_t>>   rxBuffers(g_batch, std::vector<uint8_t>(65536));
+    std::vector<uint8_t>                rxControls(g_batch * rxControlSize);
+    std::vector<struct iovec>           rxIovs(g_batch);
+    std::vector<struct mmsghdr>         rxMsgs(g_batch);
+    uint8_t                             singleBuffer[2048];
+
+    for(int x = 0; x < g_batch; x++)
+    {
+        rxIovs[x].iov_base = rxBuffers[x].data();
+        rxIovs[x].iov_len = rxBuffers[x].size();
+        memset(&rxMsgs[x], 0, sizeof(rxMsgs[x]));
+        rxMsgs[x].msg_hdr.msg_iov = &rxIovs[x];
+        rxMsgs[x].msg_hdr.msg_iovlen = 1;
+        rxMsgs[x].msg_hdr.msg_control = &rxControls[x * rxControlSize];
+        rxMsgs[x].msg_hdr.msg_controllen = rxControlSize;
+    }
+
+    static const char *modeNames[] = {"single", "batch", "gso"};
+    std::cout << "mcastbatch: mode=" << modeNames[g_mode]
+              << ", groups=" << g_groups
+              << ", framingMs=" << g_framingMs
+              << ", burst=" << g_burst
+              << ", size=" << g_payloadSize
+              << ", secs=" << g_secs << std::endl;
+
+    double cpuStart = BenchCommon::cpuSecs();
+    auto wallStart = std::chrono::steady_clock::now();
+    auto wallEnd = wallStart + std::chrono::seconds(g_secs);
+    std::chrono::steady_clock::time_point drainEnd;
+    bool draining = false;
+    uint64_t epollWaits = 0;
+
+    std::thread tx(txThread, txfd);
+
+    std::vector<struct epoll_event> events(g_groups);
+    while(true)
+    {
+        // Once the run is over, stop sending and keep receiving until the sockets go quiet
+        if(!draining && std::chrono::steady_clock::now() >= wallEnd)
+        {
+            g_running = false;
+            tx.join();
+            draining = true;
+            drainEnd = std::chrono::steady_clock::now() + std::chrono::milliseconds(g_drainMs);
+        }
+
+        if(draining && std::chrono::steady_clock::now() >= drainEnd)
+        {
+            break;
+        }
+
+        int n = epoll_wait(epfd, events.data(), (int)events.size(), draining ? 20 : 100);
+        epollWaits++;
+
+        if(n <= 0 && draining)
+        {
+            break;
+        }
+
+        for(int x = 0; x < n; x++)
+        {
+            RxSocket_t *s = (RxSocket_t*)events[x].data.ptr;
+
+            if(g_mode == modeSingle)
+            {
+                drainSingle(s, singleBuffer, sizeof(singleBuffer));
+            }
+            else
+            {
+                drainBatched(s, rxMsgs, rxControlSize);
+            }
+        }
+    }
+
+    double cpuUsed = BenchCommon::cpuSecs() - cpuStart;
+
+    uint64_t rxSyscalls = 0;
+    uint64_t rxPackets = 0;
+    uint64_t rxCoalesced = 0;
+    uint64_t histogram[HISTOGRAM_SLOTS] = {0};
+
+    for(int x = 0; x < g_groups; x++)
+    {
+        rxSyscalls += sockets[x].syscalls;
+        rxPackets += sockets[x].packets;
+        rxCoalesced += sockets[x].coalesced;
+        for(int y = 0; y < HISTOGRAM_SLOTS; y++)
+        {
+            histogram[y] += sockets[x].batchHistogram[y];
+        }
+
+        close(sockets[x].fd);
+    }
+
+    close(txfd);
+    close(epfd);
+
+    uint64_t totalSyscalls = g_txSyscalls + rxSyscalls + epollWaits;
+    uint64_t totalPackets = g_txPackets + rxPackets;
+
+    printf("tx packets ........... %" PRIu64 " in %" PRIu64 " syscalls (%.2f packets/syscall)\n",
+            g_txPackets, g_txSyscalls, g_txSyscalls ? (double)g_txPackets / (double)g_txSyscalls : 0.0);
+    printf("rx packets ........... %" PRIu64 " in %" PRIu64 " syscalls (%.2f packets/syscall)\n",
+            rxPackets, rxSyscalls, rxSyscalls ? (double)rxPackets / (double)rxSyscalls : 0.0);
+    if(g_mode == modeGso)
+    {
+        printf("gro coalesced reads .. %" PRIu64 "\n", rxCoalesced);
+    }
+    printf("epoll waits .......... %" PRIu64 "\n", epollWaits);
+    printf("rx loss .............. %.2f%%\n", g_txPackets ? (100.0 * (double)(g_txPackets - std::min(g_txPackets, rxPackets)) / (double)g_txPackets) : 0.0);
+    printf("cpu .................. %.3f secs (%.2f us/packet, %.2f us/syscall)\n",
+            cpuUsed, totalPackets ? (cpuUsed * 1000000.0) / (double)totalPackets : 0.0,
+            totalSyscalls ? (cpuUsed * 1000000.0) / (double)totalSyscalls : 0.0);
+
+    printf("rx packets per wakeup, all sockets:\n   ");
+    printHistogram(histogram);
+
+    if(g_perSocket)
+    {
+        printf("rx packets per wakeup, by socket:\n");
+        for(int x = 0; x < g_groups; x++)
+        {
+            printf("  group %-5d %8" PRIu64 " packets %8" PRIu64 " syscalls  ", sockets[x].group, sockets[x].packets, sockets[x].syscalls);
+            printHistogram(sockets[x].batchHistogram);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+#!/bin/bash
+
+echo "================================================================================"
+echo "Rallypoint Media Transport Benchmark"
+echo "Copyright (c) 2020 Rally Tactical Systems, Inc."
+echo "================================================================================"
+
+# Runs a talker and a listener (both engage-cmd) through a Rallypoint reached over an
+# impaired interface - once with media on the TLS connection and once with media over
+# UDP - for each impairment profile.  The listener's jitter buffer statistics are
+# captured in a log file per profile and transport for comparison.
+
+INTF=${1}
+RP_ADDRESS=${2}
+SECS=${3:-60}
+PROFILES=${4:-"lan wan 3g sat"}
+
+ENGAGE_CMD=${ENGAGE_CMD:-./engage-cmd}
+MISSION=${MISSION:-./sample_mission_template.json}
+POLICY=${POLICY:-./sample_engine_policy.json}
+GROUP_INDEX=${GROUP_INDEX:-1}
+RESULTS=${RESULTS:-./transport_bench_results}
+
+HERE=$(cd "$(dirname "${0}")" && pwd)
+
+function show_help()
+{
+    echo "usage: transport_bench.sh <network_interface> <rallypoint_address> [seconds_per_run] [\"profile ...\"]"
+    echo ""
+    echo "environment:"
+    echo "  ENGAGE_CMD    path to engage-cmd (default ./engage-cmd)"
+    echo "  MISSION       mission file (default ./sample_mission_template.json)"
+    echo "  POLICY        engine policy file (default ./sample_engine_policy.json)"
+    echo "  GROUP_INDEX   index of the audio group in the mission (default 1)"
+    echo "  RESULTS       output directory (default ./transport_bench_results)"
+}
+
+if [[ "${INTF}" == "" || "${RP_ADDRESS}" == "" ]]; then
+    show_help
+    exit 1
+fi
+
+mkdir -p ${RESULTS}
+
+# The listener logs jitter buffer statistics; underruns are where head-of-line blocking shows up
+sed 's/"logRtpJitterBufferStats":false/"logRtpJitterBufferStats":true/' ${POLICY} > ${RESULTS}/policy.json
+
+# Talker: a five-second talk spurt every six seconds for the length of the run
+TALKER_SCRIPT=${RESULTS}/talker.script
+echo "create ${GROUP_INDEX}" > ${TALKER_SCRIPT}
+echo "join ${GROUP_INDEX}" >> ${TALKER_SCRIPT}
+echo "sleep 3000" >> ${TALKER_SCRIPT}
+for (( x = 0; x < (${SECS} / 6); x++ )); do
+    echo "begintx ${GROUP_INDEX}" >> ${TALKER_SCRIPT}
+    echo "sleep 5000" >> ${TALKER_SCRIPT}
+    echo "endtx ${GROUP_INDEX}" >> ${TALKER_SCRIPT}
+    echo "sleep 1000" >> ${TALKER_SCRIPT}
+done
+echo "endscript" >> ${TALKER_SCRIPT}
+
+# Listener: join and wait for the talker to finish
+LISTENER_SCRIPT=${RESULTS}/listener.script
+echo "create ${GROUP_INDEX}" > ${LISTENER_SCRIPT}
+echo "join ${GROUP_INDEX}" >> ${LISTENER_SCRIPT}
+echo "sleep $(( (${SECS} + 5) * 1000 ))" >> ${LISTENER_SCRIPT}
+echo "endscript" >> ${LISTENER_SCRIPT}
+
+for PROFILE in ${PROFILES}; do
+    ${HERE}/impair.sh ${INTF} ${PROFILE}
+
+    for TRANSPORT in tls udp; do
+        sed "s/\${RP_ADDRESS}/${RP_ADDRESS}/g" ${HERE}/rp_${TRANSPORT}.json > ${RESULTS}/rp.json
+
+        echo "Running profile '${PROFILE}' with media over ${TRANSPORT} for ${SECS} seconds"
+
+        echo "q" | ${ENGAGE_CMD} -mission:${MISSION} -ep:${RESULTS}/policy.json -rp:${RESULTS}/rp.json \
+            -ua:LISTENER -script:${LISTENER_SCRIPT} > ${RESULTS}/${PROFILE}_${TRANSPORT}_listener.log 2>&1 &
+        LISTENER_PID=$!
+
+        sleep 2
+
+        echo "q" | ${ENGAGE_CMD} -mission:${MISSION} -ep:${RESULTS}/policy.json -rp:${RESULTS}/rp.json \
+            -ua:TALKER -script:${TALKER_SCRIPT} > ${RESULTS}/${PROFILE}_${TRANSPORT}_talker.log 2>&1
+
+        wait ${LISTENER_PID}
+    done
+done
+
+${HERE}/impair.sh ${INTF} none
+
+echo "Results are in ${RESULTS}"